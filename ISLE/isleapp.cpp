@@ -3,15 +3,18 @@
 #include "isleapp.h"
 
 #include "3dmanager/lego3dmanager.h"
+#include "anim/legoanim.h"
 #include "decomp.h"
 #include "isledebug.h"
 #include "legoanimationmanager.h"
 #include "legobuildingmanager.h"
+#include "legocharactermanager.h"
 #include "legogamestate.h"
 #include "legoinputmanager.h"
 #include "legomain.h"
 #include "legomodelpresenter.h"
 #include "legopartpresenter.h"
+#include "legopathcontroller.h"
 #include "legoutils.h"
 #include "legovideomanager.h"
 #include "legoworldpresenter.h"
@@ -177,6 +180,11 @@ IsleApp::IsleApp()
 	m_iniPath = NULL;
 	m_maxLod = RealtimeView::GetUserMaxLOD();
 	m_maxAllowedExtras = m_islandQuality <= 1 ? 10 : 20;
+	m_actorPoolSize = 8;
+	m_poseCacheQuantum = 10.0f;
+	m_poseCacheBudget = 4096;
+	m_simulationRate = 0.0f;
+	m_maxSimulationSteps = 4;
 	m_transitionType = MxTransitionManager::e_mosaic;
 	m_cursorSensitivity = 4;
 	m_touchScheme = LegoInputManager::e_gamepad;
@@ -973,6 +981,9 @@ MxResult IsleApp::SetupWindow()
 	LegoBuildingManager::configureLegoBuildingManager(m_islandQuality);
 	LegoROI::configureLegoROI(iVar10);
 	LegoAnimationManager::configureLegoAnimationManager(m_maxAllowedExtras);
+	LegoCharacterManager::configureActorPool(m_actorPoolSize);
+	LegoAnimNodeData::configurePoseCache(m_poseCacheQuantum, m_poseCacheBudget * 1024);
+	LegoPathController::configureSimulation(m_simulationRate, m_maxSimulationSteps);
 	MxTransitionManager::configureMxTransitionManager(m_transitionType);
 	RealtimeView::SetUserMaxLOD(m_maxLod);
 	if (LegoOmni::GetInstance()) {
@@ -1078,6 +1089,13 @@ bool IsleApp::LoadConfig()
 		SDL_snprintf(buf, sizeof(buf), "%f", m_maxLod);
 		iniparser_set(dict, "isle:Max LOD", buf);
 		iniparser_set(dict, "isle:Max Allowed Extras", SDL_itoa(m_maxAllowedExtras, buf, 10));
+		iniparser_set(dict, "isle:Actor Pool Size", SDL_itoa(m_actorPoolSize, buf, 10));
+		SDL_snprintf(buf, sizeof(buf), "%f", m_poseCacheQuantum);
+		iniparser_set(dict, "isle:Pose Cache Quantum", buf);
+		iniparser_set(dict, "isle:Pose Cache Budget", SDL_itoa(m_poseCacheBudget, buf, 10));
+		SDL_snprintf(buf, sizeof(buf), "%f", m_simulationRate);
+		iniparser_set(dict, "isle:Simulation Rate", buf);
+		iniparser_set(dict, "isle:Max Simulation Steps", SDL_itoa(m_maxSimulationSteps, buf, 10));
 		iniparser_set(dict, "isle:Transition Type", SDL_itoa(m_transitionType, buf, 10));
 		iniparser_set(dict, "isle:Touch Scheme", SDL_itoa(m_touchScheme, buf, 10));
 		iniparser_set(dict, "isle:Haptic", m_haptic ? "true" : "false");
@@ -1148,6 +1166,11 @@ bool IsleApp::LoadConfig()
 	m_islandTexture = iniparser_getint(dict, "isle:Island Texture", m_islandTexture);
 	m_maxLod = iniparser_getdouble(dict, "isle:Max LOD", m_maxLod);
 	m_maxAllowedExtras = iniparser_getint(dict, "isle:Max Allowed Extras", m_maxAllowedExtras);
+	m_actorPoolSize = iniparser_getint(dict, "isle:Actor Pool Size", m_actorPoolSize);
+	m_poseCacheQuantum = iniparser_getdouble(dict, "isle:Pose Cache Quantum", m_poseCacheQuantum);
+	m_poseCacheBudget = iniparser_getint(dict, "isle:Pose Cache Budget", m_poseCacheBudget);
+	m_simulationRate = iniparser_getdouble(dict, "isle:Simulation Rate", m_simulationRate);
+	m_maxSimulationSteps = iniparser_getint(dict, "isle:Max Simulation Steps", m_maxSimulationSteps);
 	m_transitionType =
 		(MxTransitionManager::TransitionType) iniparser_getint(dict, "isle:Transition Type", m_transitionType);
 	m_touchScheme = (LegoInputManager::TouchScheme) iniparser_getint(dict, "isle:Touch Scheme", m_touchScheme);
@@ -104,6 +104,11 @@ class IsleApp {
 	const char* m_iniPath;
 	MxFloat m_maxLod;
 	MxU32 m_maxAllowedExtras;
+	MxU32 m_actorPoolSize;
+	MxFloat m_poseCacheQuantum;
+	MxU32 m_poseCacheBudget;
+	MxFloat m_simulationRate;
+	MxU32 m_maxSimulationSteps;
 	MxTransitionManager::TransitionType m_transitionType;
 	LegoInputManager::TouchScheme m_touchScheme;
 	MxBool m_haptic;
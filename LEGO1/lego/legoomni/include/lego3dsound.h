@@ -27,6 +27,8 @@ class Lego3DSound {
 	// Lego3DSound::`scalar deleting destructor'
 
 private:
+	void SetPosition(const float* p_position);
+
 	ma_sound* m_sound;
 	LegoROI* m_roi;           // 0x0c
 	LegoROI* m_positionROI;   // 0x10
@@ -35,6 +37,10 @@ class Lego3DSound {
 	LegoActor* m_actor;       // 0x18
 	double m_frequencyFactor; // 0x20
 	MxS32 m_volume;           // 0x2c
+
+	// [library:audio] Last position pushed to the spatializer
+	float m_position[3];
+	MxBool m_hasPosition;
 };
 
 // GLOBAL: LEGO1 0x100db6c0
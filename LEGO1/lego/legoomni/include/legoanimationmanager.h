@@ -9,6 +9,7 @@
 #include "legotraninfolist.h"
 #include "mxcore.h"
 #include "mxgeometry/mxquaternion.h"
+#include "mxstl/stlcompat.h"
 
 class LegoAnimPresenter;
 class LegoEntity;
@@ -217,6 +218,8 @@ class LegoAnimationManager : public MxCore {
 	);
 	MxResult FUN_100609f0(MxU32 p_objectId, MxMatrix* p_matrix, MxBool p_und1, MxBool p_und2);
 	void DeleteAnimations();
+	void CacheWorldInfo(LegoOmni::World p_worldId);
+	void RestoreWorldInfo(LegoOmni::World p_worldId);
 	void FUN_10061530();
 	MxResult FUN_100617c0(MxS32 p_unk0x08, MxU16& p_unk0x0e, MxU16& p_unk0x10);
 	MxU16 FUN_10062110(
@@ -299,6 +302,16 @@ class LegoAnimationManager : public MxCore {
 	MxMatrix m_unk0x43c;                // 0x43c
 	MxMatrix m_unk0x484;                // 0x484
 	MxQuaternionTransformer m_unk0x4cc; // 0x4cc
+
+	// Resolved contents of a world's animation info file. Each file is only read once;
+	// later switches to the world copy the animations from here.
+	struct WorldInfo {
+		MxU16 m_animCount;
+		AnimInfo* m_anims;
+		vector<MxS32> m_activeCharacters;
+	};
+
+	WorldInfo m_worldInfo[LegoOmni::e_numWorlds];
 };
 
 // TEMPLATE: LEGO1 0x10061750
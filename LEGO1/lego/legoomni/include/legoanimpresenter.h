@@ -180,8 +180,9 @@ class LegoLoopingAnimPresenter : public LegoAnimPresenter {
 		return !strcmp(p_name, ClassName()) || LegoAnimPresenter::IsA(p_name);
 	}
 
-	void StreamingTickle() override; // vtable+0x20
-	void PutFrame() override;        // vtable+0x6c
+	void StreamingTickle() override;                      // vtable+0x20
+	void PutFrame() override;                             // vtable+0x6c
+	MxResult CreateAnim(MxStreamChunk* p_chunk) override; // vtable+0x88
 
 	// SYNTHETIC: LEGO1 0x1006d000
 	// LegoLoopingAnimPresenter::~LegoLoopingAnimPresenter
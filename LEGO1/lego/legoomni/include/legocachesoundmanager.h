@@ -7,6 +7,7 @@
 #include "mxtypes.h"
 
 #include <SDL3/SDL_stdinc.h>
+#include <unordered_map>
 
 #pragma warning(disable : 4237)
 
@@ -47,6 +48,26 @@ struct Set100d6b4cComparator {
 typedef set<LegoCacheSoundEntry, Set100d6b4cComparator> Set100d6b4c;
 typedef list<LegoCacheSoundEntry> List100d6b4c;
 
+// [library:audio]
+// Case-insensitive hash and equality for sound keys, matching Set100d6b4cComparator.
+struct LegoCacheSoundKeyHash {
+	size_t operator()(const char* p_key) const
+	{
+		size_t hash = 2166136261u;
+		for (; *p_key; p_key++) {
+			hash = (hash ^ (MxU8) SDL_tolower(*p_key)) * 16777619u;
+		}
+		return hash;
+	}
+};
+
+struct LegoCacheSoundKeyEqual {
+	bool operator()(const char* p_a, const char* p_b) const { return SDL_strcasecmp(p_a, p_b) == 0; }
+};
+
+typedef std::unordered_map<const char*, LegoCacheSound*, LegoCacheSoundKeyHash, LegoCacheSoundKeyEqual>
+	LegoCacheSoundIndex;
+
 // VTABLE: LEGO1 0x100d6b4c
 // VTABLE: BETA10 0x101becac
 // SIZE 0x20
@@ -69,6 +90,9 @@ class LegoCacheSoundManager {
 private:
 	Set100d6b4c m_set;   // 0x04
 	List100d6b4c m_list; // 0x14
+
+	// [library:audio] Lookup by key into `m_set`. Keys point into the sounds' own names.
+	LegoCacheSoundIndex m_index;
 };
 
 // SYNTHETIC: BETA10 0x100d06b0
@@ -7,6 +7,38 @@
 #include "mxstring.h"
 #include "mxwavepresenter.h"
 
+// [library:audio]
+// Immutable PCM data of a cached sound. Clones of a playing sound reference the same
+// buffer instead of copying it, so concurrent playback only costs a new miniaudio voice.
+class LegoCacheSoundData {
+public:
+	LegoCacheSoundData(MxU8* p_data, MxU32 p_dataSize)
+	{
+		m_dataSize = p_dataSize;
+		m_data = new MxU8[m_dataSize];
+		memcpy(m_data, p_data, m_dataSize);
+		m_refCount = 1;
+	}
+
+	void AddRef() { m_refCount++; }
+	void Release()
+	{
+		if (--m_refCount == 0) {
+			delete this;
+		}
+	}
+
+	MxU8* GetData() { return m_data; }
+	MxU32 GetDataSize() { return m_dataSize; }
+
+private:
+	~LegoCacheSoundData() { delete[] m_data; }
+
+	MxU8* m_data;
+	MxU32 m_dataSize;
+	MxU32 m_refCount;
+};
+
 // VTABLE: LEGO1 0x100d4718
 // VTABLE: BETA10 0x101bb6f0
 // SIZE 0x88
@@ -60,6 +92,8 @@ class LegoCacheSound : public MxCore {
 private:
 	void Init();
 	void CopyData(MxU8* p_data, MxU32 p_dataSize);
+	void ShareData(LegoCacheSoundData* p_sharedData);
+	MxResult CreateSound(MxWavePresenter::WaveFormat& p_pwfx, MxString p_mediaSrcPath, MxS32 p_volume);
 	MxString GetBaseFilename(MxString& p_path);
 
 	// [library:audio] WAVE_FORMAT_PCM (audio in .SI files only used this format)
@@ -80,6 +114,9 @@ class LegoCacheSound : public MxCore {
 	MxBool m_unk0x70;                  // 0x70
 	MxString m_unk0x74;                // 0x74
 	MxBool m_muted;                    // 0x84
+
+	// [library:audio] Owner of `m_data`, possibly shared with other clones
+	LegoCacheSoundData* m_sharedData;
 };
 
 #endif // LEGOCACHSOUND_H
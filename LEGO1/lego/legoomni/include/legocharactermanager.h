@@ -2,6 +2,7 @@
 #define LEGOCHARACTERMANAGER_H
 
 #include "decomp.h"
+#include "lego1_export.h"
 #include "mxstl/stlcompat.h"
 #include "mxtypes.h"
 #include "mxvariable.h"
@@ -97,17 +98,31 @@ class LegoCharacterManager {
 
 	static const char* GetCustomizeAnimFile() { return g_customizeAnimFile; }
 
+	LEGO1_EXPORT static void configureActorPool(MxU32 p_capacity);
+	static MxU32 GetActorPoolReuses() { return g_actorPoolReuses; }
+	static MxU32 GetActorPoolMisses() { return g_actorPoolMisses; }
+
 private:
 	LegoROI* CreateActorROI(const char* p_key);
+	MxBool PoolActorROI(LegoROI* p_roi);
+	LegoROI* ReuseActorROI(const char* p_key);
+	void FlushActorPool();
 	void RemoveROI(LegoROI* p_roi);
 	LegoROI* FindChildROI(LegoROI* p_roi, const char* p_name);
 
 	static char* g_customizeAnimFile;
 	static MxU32 g_maxMove;
 	static MxU32 g_maxSound;
+	static MxU32 g_actorPoolCapacity;
+	static MxU32 g_actorPoolReuses;
+	static MxU32 g_actorPoolMisses;
 
 	LegoCharacterMap* m_characters;                 // 0x00
 	CustomizeAnimFileVariable* m_customizeAnimFile; // 0x04
+
+	// Actor ROIs whose last reference was released, oldest first. They are kept out of
+	// the 3D manager and handed back by GetActorROI instead of cloning the LODs again.
+	vector<LegoROI*> m_pooledROIs;
 };
 
 // clang-format off
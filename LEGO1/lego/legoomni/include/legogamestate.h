@@ -10,8 +10,10 @@
 #include <string.h>
 
 class LegoFile;
+class LegoSaveWriter;
 class LegoState;
 class LegoStorage;
+class MxCore;
 class MxVariableTable;
 class MxString;
 
@@ -214,6 +216,8 @@ class LegoGameState {
 
 	LEGO1_EXPORT void SerializeScoreHistory(MxS16 p_flags);
 	LEGO1_EXPORT void SetSavePath(char*);
+	LEGO1_EXPORT void WaitForSave();
+	void SetSaveListener(MxCore* p_listener);
 
 	LegoState* GetState(const char* p_stateName);
 	LegoState* CreateState(const char* p_stateName);
@@ -272,6 +276,10 @@ class LegoGameState {
 	Area m_savedPreviousArea;             // 0x42c
 
 	static const InternationalCharacter g_intCharacters[8];
+
+private:
+	// Writes the save files in the background so that saving does not stall the game
+	LegoSaveWriter* m_saveWriter;
 };
 
 MxBool ROIColorOverride(const char* p_input, char* p_output, MxU32 p_copyLen);
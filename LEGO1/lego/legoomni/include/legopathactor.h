@@ -179,7 +179,7 @@ class LegoPathActor : public LegoActor {
 
 protected:
 	inline MxU32 FUN_1002edd0(
-		list<LegoPathBoundary*>& p_boundaries,
+		vector<LegoPathBoundary*>& p_boundaries,
 		LegoPathBoundary* p_boundary,
 		Vector3& p_v1,
 		Vector3& p_v2,
@@ -2,12 +2,15 @@
 #define LEGOPATHCONTROLLER_H
 
 #include "decomp.h"
+#include "lego1_export.h"
 #include "geom/legoorientededge.h"
 #include "legopathactor.h"
 #include "legopathboundary.h"
 #include "legopathstruct.h"
 #include "mxstl/stlcompat.h"
 
+#include <SDL3/SDL_stdinc.h>
+
 class LegoAnimPresenter;
 class LegoWorld;
 class MxAtomId;
@@ -32,6 +35,12 @@ struct LegoPathCtrlEdgeCompare {
 
 typedef set<LegoPathCtrlEdge*, LegoPathCtrlEdgeCompare> LegoPathCtrlEdgeSet;
 
+struct LegoPathBoundaryNameCompare {
+	MxBool operator()(const char* const& p_a, const char* const& p_b) const { return SDL_strcasecmp(p_a, p_b) < 0; }
+};
+
+typedef map<const char*, LegoPathBoundary*, LegoPathBoundaryNameCompare> LegoPathBoundaryNameMap;
+
 // VTABLE: LEGO1 0x100d7d60
 // VTABLE: BETA10 0x101bde20
 // SIZE 0x40
@@ -148,6 +157,8 @@ class LegoPathController : public MxCore {
 	static MxResult Init();
 	static MxResult Reset();
 
+	LEGO1_EXPORT static void configureSimulation(MxFloat p_rate, MxU32 p_maxSteps);
+
 	// FUNCTION: BETA10 0x100cf580
 	static LegoOrientedEdge* GetControlEdgeA(MxS32 p_index) { return g_ctrlEdgesA[p_index].m_edge; }
 
@@ -160,6 +171,7 @@ class LegoPathController : public MxCore {
 
 private:
 	void FUN_10046970();
+	void AnimateActors(float p_time, MxBool p_stepped);
 	MxResult Read(LegoStorage* p_storage);
 	MxResult ReadStructs(LegoStorage* p_storage);
 	MxResult ReadEdges(LegoStorage* p_storage);
@@ -167,6 +179,24 @@ class LegoPathController : public MxCore {
 	static MxResult ReadVector(LegoStorage* p_storage, Mx3DPointFloat& p_vec);
 	static MxResult ReadVector(LegoStorage* p_storage, Mx4DPointFloat& p_vec);
 
+	void InsertActor(LegoPathActor* p_actor);
+	void EraseActor(LegoPathActor* p_actor);
+	void ResetEdgeVisits();
+
+	MxBool IsEdgeUnvisited(LegoPathCtrlEdge* p_edge)
+	{
+		return p_edge >= m_edges && p_edge < m_edges + m_numE &&
+			   m_edgeVisits[p_edge - m_edges] != m_edgeVisitGeneration;
+	}
+
+	void VisitEdge(LegoPathCtrlEdge* p_edge)
+	{
+		if (IsEdgeUnvisited(p_edge)) {
+			m_edgeVisits[p_edge - m_edges] = m_edgeVisitGeneration;
+			m_numUnvisitedEdges--;
+		}
+	}
+
 	// FUNCTION: BETA10 0x100c16f0
 	static MxU32 IsBetween(MxFloat p_v, MxFloat p_a, MxFloat p_b)
 	{
@@ -203,6 +233,29 @@ class LegoPathController : public MxCore {
 	LegoPathCtrlEdgeSet m_pfsE;     // 0x20
 	LegoPathActorSet m_actors;      // 0x30
 
+	// Visited edges of the current FUN_10048310 search. An edge counts as visited when its
+	// stamp equals `m_edgeVisitGeneration`, so starting a search doesn't copy `m_pfsE`.
+	vector<MxU32> m_edgeVisits;
+	MxU32 m_edgeVisitGeneration;
+	MxS32 m_numUnvisitedEdges;
+
+	// Boundaries by name for GetPathBoundary, filled in by ReadBoundaries
+	LegoPathBoundaryNameMap m_boundaryNames;
+
+	// State of the FUN_10046970 walk over m_actors, kept up to date by InsertActor and
+	// EraseActor so actors can come and go from inside Animate.
+	MxBool m_ticking;
+	LegoPathActorSet::iterator m_tickNext;
+	LegoPathActor* m_tickLast;            // Last actor reached by the walk, NULL before the first
+	vector<LegoPathActor*> m_tickAdded;   // Inserted during the walk, not animated by it
+	vector<LegoPathActor*> m_tickRemoved; // Erased during the walk after being part of it
+
+	// Time the actors were last animated to when stepping at a fixed rate, or -1
+	float m_simulationTime;
+
+	static MxFloat g_simulationStep;
+	static MxU32 g_maxSimulationSteps;
+
 	// Names verified by BETA10
 	static CtrlBoundary* g_ctrlBoundariesA;
 	static CtrlEdge* g_ctrlEdgesA;
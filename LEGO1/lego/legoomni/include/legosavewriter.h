@@ -0,0 +1,79 @@
+#ifndef LEGOSAVEWRITER_H
+#define LEGOSAVEWRITER_H
+
+#include "mxcore.h"
+#include "mxnotificationparam.h"
+#include "mxstl/stlcompat.h"
+#include "mxstring.h"
+#include "mxthread.h"
+
+#include <SDL3/SDL_mutex.h>
+
+class LegoGrowableMemory;
+
+// Sent to the save listener once a file queued by LegoSaveWriter is on disk
+class LegoSaveNotificationParam : public MxNotificationParam {
+public:
+	LegoSaveNotificationParam(MxResult p_result)
+		: MxNotificationParam(c_notificationSaveComplete, NULL), m_result(p_result)
+	{
+	}
+
+	MxNotificationParam* Clone() const override { return new LegoSaveNotificationParam(m_result); }
+
+	MxResult GetResult() const { return m_result; }
+
+private:
+	MxResult m_result;
+};
+
+// Writes save files on a background thread. Every file is written to a temporary
+// file next to it first and renamed over the old one once complete, so a write that
+// is interrupted leaves the previous file intact. Files are written in the order
+// they were queued.
+class LegoSaveWriter : public MxCore {
+public:
+	LegoSaveWriter();
+	~LegoSaveWriter() override;
+
+	MxResult Tickle() override;
+
+	const char* ClassName() const override { return "LegoSaveWriter"; }
+
+	MxResult Queue(const char* p_path, LegoGrowableMemory* p_data);
+	void Wait();
+
+	void SetListener(MxCore* p_listener) { m_listener = p_listener; }
+
+	static MxResult WriteFile(const char* p_path, LegoGrowableMemory* p_data);
+
+private:
+	class WriteThread : public MxThread {
+	public:
+		WriteThread(LegoSaveWriter* p_writer) { m_writer = p_writer; }
+
+		MxResult Run() override;
+
+	private:
+		LegoSaveWriter* m_writer;
+	};
+
+	struct Job {
+		MxString m_path;
+		LegoGrowableMemory* m_data;
+		MxResult m_result;
+	};
+
+	void Write(Job* p_job);
+	MxBool WriteNext();
+
+	WriteThread* m_thread;
+	SDL_Mutex* m_mutex;
+	SDL_Condition* m_condition;
+	list<Job*> m_pending;  // The front job is the one being written
+	list<Job*> m_finished; // Written, waiting to be reported to the listener
+	MxBool m_shutdown;
+	MxCore* m_listener;
+};
+
+#endif // LEGOSAVEWRITER_H
@@ -31,6 +31,13 @@ class LegoSoundManager : public MxSoundManager {
 	void Destroy(MxBool p_fromDestructor);
 
 	LegoCacheSoundManager* m_cacheSoundManager; // 0x40
+
+	// [library:audio] Last listener state pushed to the engine
+	float m_listenerPosition[3];
+	float m_listenerDirection[3];
+	float m_listenerUp[3];
+	MxBool m_hasListenerPosition;
+	MxBool m_hasListenerDirection;
 };
 
 // GLOBAL: LEGO1 0x100db6d0
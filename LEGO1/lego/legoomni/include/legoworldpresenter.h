@@ -18,6 +18,7 @@ class LegoWorldPresenter : public LegoEntityPresenter {
 	~LegoWorldPresenter() override; // vtable+0x00
 
 	LEGO1_EXPORT static void configureLegoWorldPresenter(MxS32 p_legoWorldPresenterQuality);
+	static void ReleaseModelDb();
 
 	// FUNCTION: BETA10 0x100e41c0
 	static const char* HandlerClassName()
@@ -33,6 +33,7 @@ void Lego3DSound::Init()
 	m_enabled = FALSE;
 	m_isActor = FALSE;
 	m_volume = 79;
+	m_hasPosition = FALSE;
 }
 
 // FUNCTION: LEGO1 0x100116a0
@@ -48,6 +49,7 @@ MxResult Lego3DSound::Create(ma_sound* p_sound, const char* p_name, MxS32 p_volu
 		ma_sound_set_max_distance(m_sound, 100.0f);
 		ma_sound_set_position(m_sound, 0.0f, 0.0f, 40.0f);
 		ma_sound_set_rolloff(m_sound, 10.0f);
+		m_hasPosition = FALSE;
 	}
 
 	if (m_sound == NULL || p_name == NULL) {
@@ -82,8 +84,7 @@ MxResult Lego3DSound::Create(ma_sound* p_sound, const char* p_name, MxS32 p_volu
 	}
 
 	if (MxOmni::IsSound3D()) {
-		const float* position = m_positionROI->GetWorldPosition();
-		ma_sound_set_position(m_sound, position[0], position[1], -position[2]);
+		SetPosition(m_positionROI->GetWorldPosition());
 	}
 
 	LegoEntity* entity = m_roi->GetEntity();
@@ -139,7 +140,7 @@ MxU32 Lego3DSound::UpdatePosition(ma_sound* p_sound)
 		}
 
 		if (m_sound != NULL) {
-			ma_sound_set_position(m_sound, position[0], position[1], -position[2]);
+			SetPosition(position);
 		}
 		else {
 			MxS32 newVolume = m_volume;
@@ -215,8 +216,7 @@ void Lego3DSound::FUN_10011a60(ma_sound* p_sound, const char* p_name)
 
 		if (m_sound != NULL) {
 			ma_sound_set_spatialization_enabled(m_sound, MA_TRUE);
-			const float* position = m_positionROI->GetWorldPosition();
-			ma_sound_set_position(m_sound, position[0], position[1], -position[2]);
+			SetPosition(m_positionROI->GetWorldPosition());
 		}
 		else {
 			const float* position = m_positionROI->GetWorldPosition();
@@ -260,6 +260,18 @@ void Lego3DSound::FUN_10011a60(ma_sound* p_sound, const char* p_name)
 	}
 }
 
+void Lego3DSound::SetPosition(const float* p_position)
+{
+	// [library:audio]
+	// Most emitters are attached to static ROIs. Only touch the spatializer (which takes
+	// a lock shared with the mixer) when the emitter has actually moved.
+	if (!m_hasPosition || !EQVEC3(m_position, p_position)) {
+		ma_sound_set_position(m_sound, p_position[0], p_position[1], -p_position[2]);
+		SET3(m_position, p_position);
+		m_hasPosition = TRUE;
+	}
+}
+
 // FUNCTION: LEGO1 0x10011ca0
 void Lego3DSound::Reset()
 {
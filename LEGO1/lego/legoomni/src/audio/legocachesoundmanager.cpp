@@ -12,6 +12,8 @@ LegoCacheSoundManager::~LegoCacheSoundManager()
 {
 	LegoCacheSound* sound;
 
+	m_index.clear();
+
 	while (!m_set.empty()) {
 		sound = (*m_set.begin()).GetSound();
 		m_set.erase(m_set.begin());
@@ -68,12 +70,10 @@ LegoCacheSound* LegoCacheSoundManager::FindSoundByKey(const char* p_key)
 {
 	// This function has changed completely since BETA10, but its calls suggest the match is correct
 
-	char* key = new char[strlen(p_key) + 1];
-	strcpy(key, p_key);
-
-	Set100d6b4c::iterator it = m_set.find(LegoCacheSoundEntry(NULL, key));
-	if (it != m_set.end()) {
-		return (*it).GetSound();
+	// [library:audio] Hash lookup instead of copying the key for an ordered set search
+	LegoCacheSoundIndex::iterator it = m_index.find(p_key);
+	if (it != m_index.end()) {
+		return it->second;
 	}
 
 	return NULL;
@@ -82,9 +82,9 @@ LegoCacheSound* LegoCacheSoundManager::FindSoundByKey(const char* p_key)
 // FUNCTION: LEGO1 0x1003d290
 LegoCacheSound* LegoCacheSoundManager::ManageSoundEntry(LegoCacheSound* p_sound)
 {
-	Set100d6b4c::iterator it = m_set.find(LegoCacheSoundEntry(p_sound));
-	if (it != m_set.end()) {
-		LegoCacheSound* sound = (*it).GetSound();
+	LegoCacheSoundIndex::iterator it = m_index.find(p_sound->GetUnknown0x48().GetData());
+	if (it != m_index.end()) {
+		LegoCacheSound* sound = it->second;
 
 		if (sound->GetUnknown0x58()) {
 			m_list.push_back(LegoCacheSoundEntry(p_sound));
@@ -97,6 +97,7 @@ LegoCacheSound* LegoCacheSoundManager::ManageSoundEntry(LegoCacheSound* p_sound)
 	}
 
 	m_set.insert(LegoCacheSoundEntry(p_sound));
+	m_index[p_sound->GetUnknown0x48().GetData()] = p_sound;
 	LegoWorld* world = CurrentWorld();
 	if (world) {
 		world->Add(p_sound);
@@ -183,6 +184,7 @@ void LegoCacheSoundManager::Destroy(LegoCacheSound*& p_sound)
 		if ((*setIter).GetSound() == p_sound) {
 			p_sound->Stop();
 
+			m_index.erase(p_sound->GetUnknown0x48().GetData());
 			delete p_sound;
 			m_set.erase(setIter);
 			return;
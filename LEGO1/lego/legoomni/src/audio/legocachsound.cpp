@@ -29,6 +29,7 @@ void LegoCacheSound::Init()
 	SDL_zero(m_buffer);
 	SDL_zero(m_cacheSound);
 	m_data = NULL;
+	m_sharedData = NULL;
 	m_unk0x58 = FALSE;
 	memset(&m_wfx, 0, sizeof(m_wfx));
 	m_looping = TRUE;
@@ -55,10 +56,14 @@ MxResult LegoCacheSound::Create(
 	assert(p_pwfx.m_bitsPerSample == 8 || p_pwfx.m_bitsPerSample == 16);
 
 	CopyData(p_data, p_dataSize);
+	return CreateSound(p_pwfx, p_mediaSrcPath, p_volume);
+}
 
+MxResult LegoCacheSound::CreateSound(MxWavePresenter::WaveFormat& p_pwfx, MxString p_mediaSrcPath, MxS32 p_volume)
+{
 	ma_format format = p_pwfx.m_bitsPerSample == 16 ? ma_format_s16 : ma_format_u8;
 	ma_uint32 bytesPerFrame = ma_get_bytes_per_frame(format, p_pwfx.m_channels);
-	ma_uint32 bufferSizeInFrames = p_dataSize / bytesPerFrame;
+	ma_uint32 bufferSizeInFrames = m_dataSize / bytesPerFrame;
 	ma_audio_buffer_config config =
 		ma_audio_buffer_config_init(format, p_pwfx.m_channels, bufferSizeInFrames, m_data, NULL);
 	config.sampleRate = p_pwfx.m_samplesPerSec;
@@ -98,10 +103,25 @@ void LegoCacheSound::CopyData(MxU8* p_data, MxU32 p_dataSize)
 	assert(p_data);
 	assert(p_dataSize);
 
-	delete[] m_data;
-	m_dataSize = p_dataSize;
-	m_data = new MxU8[m_dataSize];
-	memcpy(m_data, p_data, m_dataSize);
+	ShareData(NULL);
+	m_sharedData = new LegoCacheSoundData(p_data, p_dataSize);
+	m_data = m_sharedData->GetData();
+	m_dataSize = m_sharedData->GetDataSize();
+}
+
+void LegoCacheSound::ShareData(LegoCacheSoundData* p_sharedData)
+{
+	if (p_sharedData) {
+		p_sharedData->AddRef();
+	}
+
+	if (m_sharedData) {
+		m_sharedData->Release();
+	}
+
+	m_sharedData = p_sharedData;
+	m_data = m_sharedData ? m_sharedData->GetData() : NULL;
+	m_dataSize = m_sharedData ? m_sharedData->GetDataSize() : 0;
 }
 
 // FUNCTION: LEGO1 0x10006920
@@ -111,7 +131,7 @@ void LegoCacheSound::Destroy()
 	m_cacheSound.Destroy(ma_sound_uninit);
 	m_buffer.Destroy(ma_audio_buffer_uninit);
 
-	delete[] m_data;
+	ShareData(NULL);
 	Init();
 }
 
@@ -122,7 +142,10 @@ LegoCacheSound* LegoCacheSound::Clone()
 	LegoCacheSound* pnew = new LegoCacheSound();
 	assert(pnew);
 
-	MxResult result = pnew->Create(m_wfx, m_unk0x48, m_volume, m_data, m_dataSize);
+	// [library:audio] Reference the PCM data instead of copying it
+	pnew->ShareData(m_sharedData);
+
+	MxResult result = pnew->CreateSound(m_wfx, m_unk0x48, m_volume);
 	if (result == SUCCESS) {
 		return pnew;
 	}
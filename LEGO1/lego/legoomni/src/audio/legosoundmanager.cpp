@@ -5,6 +5,7 @@
 #include "mxmain.h"
 
 #include <assert.h>
+#include <vec.h>
 
 DECOMP_SIZE_ASSERT(LegoSoundManager, 0x44)
 
@@ -27,6 +28,8 @@ LegoSoundManager::~LegoSoundManager()
 void LegoSoundManager::Init()
 {
 	m_cacheSoundManager = NULL;
+	m_hasListenerPosition = FALSE;
+	m_hasListenerDirection = FALSE;
 }
 
 // FUNCTION: LEGO1 0x100299b0
@@ -101,13 +104,23 @@ void LegoSoundManager::UpdateListener(
 		// miniaudio expects the right-handed OpenGL coordinate system, while LEGO Island
 		// uses DirectX' left-handed system. The Z-axis needs to be inverted.
 
-		if (p_position != NULL) {
+		// [library:audio]
+		// The camera controllers push the listener on every update, even while stationary.
+		// Skip the engine update (which locks against the mixer) when nothing moved.
+		if (p_position != NULL && (!m_hasListenerPosition || !EQVEC3(m_listenerPosition, p_position))) {
 			ma_engine_listener_set_position(m_engine, 0, p_position[0], p_position[1], -p_position[2]);
+			SET3(m_listenerPosition, p_position);
+			m_hasListenerPosition = TRUE;
 		}
 
-		if (p_direction != NULL && p_up != NULL) {
+		if (p_direction != NULL && p_up != NULL &&
+			(!m_hasListenerDirection || !EQVEC3(m_listenerDirection, p_direction) ||
+			 !EQVEC3(m_listenerUp, p_up))) {
 			ma_engine_listener_set_direction(m_engine, 0, p_direction[0], p_direction[1], -p_direction[2]);
 			ma_engine_listener_set_world_up(m_engine, 0, p_up[0], p_up[1], -p_up[2]);
+			SET3(m_listenerDirection, p_direction);
+			SET3(m_listenerUp, p_up);
+			m_hasListenerDirection = TRUE;
 		}
 
 		if (p_velocity != NULL) {
@@ -323,6 +323,46 @@ void LegoAnimationManager::configureLegoAnimationManager(MxS32 p_legoAnimationMa
 	g_legoAnimationManagerConfig = p_legoAnimationManagerConfig;
 }
 
+static AnimInfo* CopyAnimInfo(const AnimInfo* p_anims, MxU16 p_count)
+{
+	AnimInfo* anims = new AnimInfo[p_count];
+	memcpy(anims, p_anims, p_count * sizeof(*anims));
+
+	for (MxS32 i = 0; i < p_count; i++) {
+		anims[i].m_name = new char[strlen(p_anims[i].m_name) + 1];
+		strcpy(anims[i].m_name, p_anims[i].m_name);
+
+		anims[i].m_models = new ModelInfo[p_anims[i].m_modelCount];
+		memcpy(anims[i].m_models, p_anims[i].m_models, p_anims[i].m_modelCount * sizeof(*anims[i].m_models));
+
+		for (MxS32 j = 0; j < p_anims[i].m_modelCount; j++) {
+			anims[i].m_models[j].m_name = new char[strlen(p_anims[i].m_models[j].m_name) + 1];
+			strcpy(anims[i].m_models[j].m_name, p_anims[i].m_models[j].m_name);
+		}
+	}
+
+	return anims;
+}
+
+static void DeleteAnimInfo(AnimInfo* p_anims, MxU16 p_count)
+{
+	if (p_anims != NULL) {
+		for (MxS32 i = 0; i < p_count; i++) {
+			delete[] p_anims[i].m_name;
+
+			if (p_anims[i].m_models != NULL) {
+				for (MxS32 j = 0; j < p_anims[i].m_modelCount; j++) {
+					delete[] p_anims[i].m_models[j].m_name;
+				}
+
+				delete[] p_anims[i].m_models;
+			}
+		}
+
+		delete[] p_anims;
+	}
+}
+
 // FUNCTION: LEGO1 0x1005eb60
 // FUNCTION: BETA10 0x1003f940
 LegoAnimationManager::LegoAnimationManager()
@@ -331,6 +371,11 @@ LegoAnimationManager::LegoAnimationManager()
 	m_animState = NULL;
 	m_unk0x424 = NULL;
 
+	for (MxS32 i = 0; i < (MxS32) sizeOfArray(m_worldInfo); i++) {
+		m_worldInfo[i].m_animCount = 0;
+		m_worldInfo[i].m_anims = NULL;
+	}
+
 	Init();
 
 	NotificationManager()->Register(this);
@@ -370,6 +415,10 @@ LegoAnimationManager::~LegoAnimationManager()
 
 	DeleteAnimations();
 
+	for (MxS32 i = 0; i < (MxS32) sizeOfArray(m_worldInfo); i++) {
+		DeleteAnimInfo(m_worldInfo[i].m_anims, m_worldInfo[i].m_animCount);
+	}
+
 	if (m_unk0x424 != NULL) {
 		FUN_10063aa0();
 		delete m_unk0x424;
@@ -629,6 +678,11 @@ MxResult LegoAnimationManager::LoadWorldInfo(LegoOmni::World p_worldId)
 			goto done;
 		}
 
+		if (m_worldInfo[p_worldId].m_anims != NULL) {
+			RestoreWorldInfo(p_worldId);
+			goto loaded;
+		}
+
 		char filename[128];
 		char path[1024];
 		sprintf(filename, "lego\\data\\%sinf.dta", Lego()->GetWorldName(p_worldId));
@@ -715,6 +769,9 @@ MxResult LegoAnimationManager::LoadWorldInfo(LegoOmni::World p_worldId)
 			}
 		}
 
+		CacheWorldInfo(p_worldId);
+
+	loaded:
 		m_worldId = p_worldId;
 		m_tranInfoList = new LegoTranInfoList();
 		m_tranInfoList2 = new LegoTranInfoList();
@@ -763,19 +820,12 @@ MxBool LegoAnimationManager::FindVehicle(const char* p_name, MxU32& p_index)
 MxResult LegoAnimationManager::ReadAnimInfo(LegoStorage* p_storage, AnimInfo* p_info)
 {
 	MxResult result = FAILURE;
-	MxU8 length;
-	MxS32 i, j;
-
-	if (p_storage->Read(&length, sizeof(MxU8)) == FAILURE) {
-		goto done;
-	}
+	MxS32 j;
 
-	p_info->m_name = new char[length + 1];
-	if (p_storage->Read(p_info->m_name, length) == FAILURE) {
+	if (p_storage->ReadU8String(p_info->m_name) == FAILURE) {
 		goto done;
 	}
 
-	p_info->m_name[length] = 0;
 	if (p_storage->Read(&p_info->m_objectId, sizeof(MxU32)) == FAILURE) {
 		goto done;
 	}
@@ -796,10 +846,8 @@ MxResult LegoAnimationManager::ReadAnimInfo(LegoStorage* p_storage, AnimInfo* p_
 		goto done;
 	}
 
-	for (i = 0; i < (MxS32) sizeOfArray(p_info->m_unk0x10); i++) {
-		if (p_storage->Read(&p_info->m_unk0x10[i], sizeof(float)) != SUCCESS) {
-			goto done;
-		}
+	if (p_storage->ReadFloats(p_info->m_unk0x10, sizeOfArray(p_info->m_unk0x10)) != SUCCESS) {
+		goto done;
 	}
 
 	if (p_storage->Read(&p_info->m_modelCount, sizeof(MxU8)) == FAILURE) {
@@ -825,29 +873,22 @@ MxResult LegoAnimationManager::ReadAnimInfo(LegoStorage* p_storage, AnimInfo* p_
 MxResult LegoAnimationManager::ReadModelInfo(LegoStorage* p_storage, ModelInfo* p_info)
 {
 	MxResult result = FAILURE;
-	MxU8 length;
-
-	if (p_storage->Read(&length, sizeof(MxU8)) == FAILURE) {
-		goto done;
-	}
 
-	p_info->m_name = new char[length + 1];
-	if (p_storage->Read(p_info->m_name, length) == FAILURE) {
+	if (p_storage->ReadU8String(p_info->m_name) == FAILURE) {
 		goto done;
 	}
 
-	p_info->m_name[length] = 0;
 	if (p_storage->Read(&p_info->m_unk0x04, sizeof(MxU8)) == FAILURE) {
 		goto done;
 	}
 
-	if (p_storage->Read(p_info->m_location, 3 * sizeof(float)) != SUCCESS) {
+	if (p_storage->ReadFloats(p_info->m_location, 3) != SUCCESS) {
 		goto done;
 	}
-	if (p_storage->Read(p_info->m_direction, 3 * sizeof(float)) != SUCCESS) {
+	if (p_storage->ReadFloats(p_info->m_direction, 3) != SUCCESS) {
 		goto done;
 	}
-	if (p_storage->Read(p_info->m_up, 3 * sizeof(float)) != SUCCESS) {
+	if (p_storage->ReadFloats(p_info->m_up, 3) != SUCCESS) {
 		goto done;
 	}
 	if (p_storage->Read(&p_info->m_unk0x2c, sizeof(MxU8)) == FAILURE) {
@@ -865,24 +906,38 @@ void LegoAnimationManager::DeleteAnimations()
 {
 	MxBool suspended = m_suspended;
 
-	if (m_anims != NULL) {
-		for (MxS32 i = 0; i < m_animCount; i++) {
-			delete[] m_anims[i].m_name;
+	DeleteAnimInfo(m_anims, m_animCount);
 
-			if (m_anims[i].m_models != NULL) {
-				for (MxS32 j = 0; j < m_anims[i].m_modelCount; j++) {
-					delete[] m_anims[i].m_models[j].m_name;
-				}
+	Init();
+	m_suspended = suspended;
+}
 
-				delete[] m_anims[i].m_models;
-			}
-		}
+// Keeps a copy of the animations just read for p_worldId, before any of them are played
+void LegoAnimationManager::CacheWorldInfo(LegoOmni::World p_worldId)
+{
+	WorldInfo& info = m_worldInfo[p_worldId];
+
+	info.m_animCount = m_animCount;
+	info.m_anims = CopyAnimInfo(m_anims, m_animCount);
+	info.m_activeCharacters.clear();
 
-		delete[] m_anims;
+	for (MxS32 i = 0; i < (MxS32) sizeOfArray(g_characters); i++) {
+		if (g_characters[i].m_active) {
+			info.m_activeCharacters.push_back(i);
+		}
 	}
+}
 
-	Init();
-	m_suspended = suspended;
+void LegoAnimationManager::RestoreWorldInfo(LegoOmni::World p_worldId)
+{
+	WorldInfo& info = m_worldInfo[p_worldId];
+
+	m_animCount = info.m_animCount;
+	m_anims = CopyAnimInfo(info.m_anims, info.m_animCount);
+
+	for (vector<MxS32>::iterator it = info.m_activeCharacters.begin(); it != info.m_activeCharacters.end(); it++) {
+		g_characters[*it].m_active = TRUE;
+	}
 }
 
 // FUNCTION: LEGO1 0x10060480
@@ -2988,8 +3043,6 @@ MxResult AnimState::Serialize(LegoStorage* p_storage)
 
 	if (result == SUCCESS) {
 		if (p_storage->IsReadMode()) {
-			MxS32 i;
-
 			p_storage->ReadU32(m_extraCharacterId);
 
 			if (m_unk0x10) {
@@ -3009,9 +3062,7 @@ MxResult AnimState::Serialize(LegoStorage* p_storage)
 			m_unk0x10 = new MxU16[m_unk0x0c];
 #endif
 
-			for (i = 0; i < m_unk0x0c; i++) {
-				p_storage->ReadU16(m_unk0x10[i]);
-			}
+			p_storage->ReadU16s(m_unk0x10, m_unk0x0c);
 
 			// Note that here we read first and then free memory in contrast to above
 			p_storage->ReadU32(m_locationsFlagsLength);
@@ -3031,9 +3082,7 @@ MxResult AnimState::Serialize(LegoStorage* p_storage)
 			m_locationsFlags = new MxBool[m_locationsFlagsLength];
 #endif
 
-			for (i = 0; i < m_locationsFlagsLength; i++) {
-				p_storage->ReadU8(m_locationsFlags[i]);
-			}
+			p_storage->Read(m_locationsFlags, m_locationsFlagsLength * sizeof(MxBool));
 		}
 		else if (p_storage->IsWriteMode()) {
 			MxS32 i;
@@ -56,6 +56,90 @@ MxU32 g_autoRoiCounter = 0;
 // GLOBAL: LEGO1 0x10104f20
 LegoActorInfo g_actorInfo[66];
 
+MxU32 LegoCharacterManager::g_actorPoolCapacity = 8;
+MxU32 LegoCharacterManager::g_actorPoolReuses = 0;
+MxU32 LegoCharacterManager::g_actorPoolMisses = 0;
+
+// Returns the LOD list for actor part p_index with its texture or color applied.
+// Every actor whose part has the same geometry and appearance shares one list, so
+// the list must not be recolored in place; switch the part to another list instead.
+// The returned list's refCount is increased, i.e. caller must call Release().
+static ViewLODList* GetActorPartLODList(LegoActorInfo::Part& p_part, MxS32 p_index)
+{
+	ViewLODListManager* lodManager = GetViewLODListManager();
+	const char* name = p_part.m_names[p_part.m_nameIndices[p_part.m_nameIndex]];
+
+	const char* parentName;
+	if (p_index == 0 || p_index == 1) {
+		parentName = p_part.m_partName[p_part.m_partNameIndices[p_part.m_partNameIndex]];
+	}
+	else {
+		parentName = g_actorLODs[p_index + 1].m_parentName;
+	}
+
+	char lodName[256];
+	SDL_snprintf(lodName, sizeof(lodName), "%s:%s:%s", g_actorLODs[p_index + 1].m_name, parentName, name);
+
+	ViewLODList* dupLodList = lodManager->Lookup(lodName);
+	if (dupLodList != NULL) {
+		return dupLodList;
+	}
+
+	ViewLODList* lodList = lodManager->Lookup(parentName);
+	assert(lodList);
+
+	MxS32 lodSize = lodList->Size();
+	dupLodList = lodManager->Create(lodName, lodSize);
+
+	Tgl::Renderer* renderer = VideoManager()->GetRenderer();
+	LegoTextureInfo* textureInfo = NULL;
+	MxBool useColor = FALSE;
+	LegoFloat red, green, blue, alpha;
+
+	if (g_actorLODs[p_index + 1].m_flags & LegoActorLOD::c_useTexture &&
+		(p_index != 0 || p_part.m_partNameIndices[p_part.m_partNameIndex] != 0)) {
+		textureInfo = TextureContainer()->Get(name);
+	}
+	else if (g_actorLODs[p_index + 1].m_flags & LegoActorLOD::c_useColor || (p_index == 0 && p_part.m_partNameIndices[p_part.m_partNameIndex] == 0)) {
+		LegoROI::GetRGBAColor(name, red, green, blue, alpha);
+		useColor = TRUE;
+	}
+
+	for (MxS32 j = 0; j < lodSize; j++) {
+		LegoLOD* lod = (LegoLOD*) (*lodList)[j];
+		LegoLOD* clone = lod->Clone(renderer);
+
+		if (textureInfo != NULL) {
+			clone->SetTextureInfo(textureInfo);
+			clone->SetColor(1.0F, 1.0F, 1.0F, 0.0F);
+		}
+		else if (useColor) {
+			clone->SetColor(red, green, blue, alpha);
+		}
+
+		dupLodList->PushBack(clone);
+	}
+
+	lodList->Release();
+	return dupLodList;
+}
+
+// Switches the LOD list of actor part p_index on its child ROI to the one matching p_part
+static void SetActorPartLODList(LegoROI* p_childROI, LegoActorInfo::Part& p_part, MxS32 p_index)
+{
+	ViewLODList* lodList = GetActorPartLODList(p_part, p_index);
+
+	if (p_childROI->GetLODs() != lodList) {
+		if (p_childROI->GetLodLevel() >= 0) {
+			VideoManager()->Get3DManager()->GetLego3DView()->GetViewManager()->RemoveROIDetailFromScene(p_childROI);
+		}
+
+		p_childROI->SetLODList(lodList);
+	}
+
+	lodList->Release();
+}
+
 // FUNCTION: LEGO1 0x10082a20
 // FUNCTION: BETA10 0x10073c60
 LegoCharacterManager::LegoCharacterManager()
@@ -83,6 +167,7 @@ LegoCharacterManager::~LegoCharacterManager()
 		delete (*it).second;
 	}
 
+	FlushActorPool();
 	delete m_characters;
 	delete[] g_customizeAnimFile;
 }
@@ -90,6 +175,8 @@ LegoCharacterManager::~LegoCharacterManager()
 // FUNCTION: LEGO1 0x10083270
 void LegoCharacterManager::Init()
 {
+	FlushActorPool();
+
 	for (MxS32 i = 0; i < sizeOfArray(g_actorInfo); i++) {
 		g_actorInfo[i] = g_actorInfoInit[i];
 	}
@@ -185,6 +272,9 @@ MxResult LegoCharacterManager::Read(LegoStorage* p_storage)
 {
 	MxResult result = FAILURE;
 
+	// Pooled ROIs were built from the actor info that is about to be replaced
+	FlushActorPool();
+
 	for (MxS32 i = 0; i < sizeOfArray(g_actorInfo); i++) {
 		LegoActorInfo* info = &g_actorInfo[i];
 
@@ -258,7 +348,11 @@ LegoROI* LegoCharacterManager::GetActorROI(const char* p_name, MxBool p_createEn
 	}
 
 	if (character == NULL) {
-		LegoROI* roi = CreateActorROI(p_name);
+		LegoROI* roi = ReuseActorROI(p_name);
+
+		if (roi == NULL) {
+			roi = CreateActorROI(p_name);
+		}
 
 		if (roi != NULL) {
 			roi->SetVisibility(FALSE);
@@ -345,6 +439,10 @@ void LegoCharacterManager::ReleaseActor(const char* p_name)
 
 			RemoveROI(character->m_roi);
 
+			if (info != NULL && PoolActorROI(character->m_roi)) {
+				character->m_roi = NULL;
+			}
+
 			delete[] (*it).first;
 			delete (*it).second;
 
@@ -387,6 +485,10 @@ void LegoCharacterManager::ReleaseActor(LegoROI* p_roi)
 
 				RemoveROI(character->m_roi);
 
+				if (info != NULL && PoolActorROI(character->m_roi)) {
+					character->m_roi = NULL;
+				}
+
 				delete[] (*it).first;
 				delete (*it).second;
 
@@ -467,8 +569,6 @@ LegoROI* LegoCharacterManager::CreateActorROI(const char* p_key)
 	MxS32 i;
 
 	Tgl::Renderer* renderer = VideoManager()->GetRenderer();
-	ViewLODListManager* lodManager = GetViewLODListManager();
-	LegoTextureContainer* textureContainer = TextureContainer();
 	LegoActorInfo* info = GetActorInfo(p_key);
 
 	if (info == NULL) {
@@ -508,31 +608,7 @@ LegoROI* LegoCharacterManager::CreateActorROI(const char* p_key)
 	roi->SetComp(comp);
 
 	for (i = 0; i < sizeOfArray(g_actorLODs) - 1; i++) {
-		char lodName[256];
-		LegoActorInfo::Part& part = info->m_parts[i];
-
-		const char* parentName;
-		if (i == 0 || i == 1) {
-			parentName = part.m_partName[part.m_partNameIndices[part.m_partNameIndex]];
-		}
-		else {
-			parentName = g_actorLODs[i + 1].m_parentName;
-		}
-
-		ViewLODList* lodList = lodManager->Lookup(parentName);
-		MxS32 lodSize = lodList->Size();
-		sprintf(lodName, "%s%d", p_key, i);
-		ViewLODList* dupLodList = lodManager->Create(lodName, lodSize);
-
-		for (MxS32 j = 0; j < lodSize; j++) {
-			LegoLOD* lod = (LegoLOD*) (*lodList)[j];
-			LegoLOD* clone = lod->Clone(renderer);
-			dupLodList->PushBack(clone);
-		}
-
-		lodList->Release();
-		lodList = dupLodList;
-
+		ViewLODList* lodList = GetActorPartLODList(info->m_parts[i], i);
 		LegoROI* childROI = new LegoROI(renderer, lodList);
 		lodList->Release();
 
@@ -563,22 +639,6 @@ LegoROI* LegoCharacterManager::CreateActorROI(const char* p_key)
 		);
 		childROI->WrappedSetLocal2WorldWithWorldDataUpdate(mat);
 
-		if (g_actorLODs[i + 1].m_flags & LegoActorLOD::c_useTexture &&
-			(i != 0 || part.m_partNameIndices[part.m_partNameIndex] != 0)) {
-
-			LegoTextureInfo* textureInfo = textureContainer->Get(part.m_names[part.m_nameIndices[part.m_nameIndex]]);
-
-			if (textureInfo != NULL) {
-				childROI->SetTextureInfo(textureInfo);
-				childROI->SetLodColor(1.0F, 1.0F, 1.0F, 0.0F);
-			}
-		}
-		else if (g_actorLODs[i + 1].m_flags & LegoActorLOD::c_useColor || (i == 0 && part.m_partNameIndices[part.m_partNameIndex] == 0)) {
-			LegoFloat red, green, blue, alpha;
-			childROI->GetRGBAColor(part.m_names[part.m_nameIndices[part.m_nameIndex]], red, green, blue, alpha);
-			childROI->SetLodColor(red, green, blue, alpha);
-		}
-
 		comp->push_back(childROI);
 	}
 
@@ -602,6 +662,83 @@ LegoROI* LegoCharacterManager::CreateActorROI(const char* p_key)
 	return roi;
 }
 
+// Keeps an actor ROI whose last reference is gone so GetActorROI can hand it out again
+MxBool LegoCharacterManager::PoolActorROI(LegoROI* p_roi)
+{
+	// "pep" copies Pepper's current parts every time its ROI is created
+	if (g_actorPoolCapacity == 0 || !SDL_strcasecmp(p_roi->GetName(), "pep")) {
+		return FALSE;
+	}
+
+	if (m_pooledROIs.size() >= g_actorPoolCapacity) {
+		delete m_pooledROIs.front();
+		m_pooledROIs.erase(m_pooledROIs.begin());
+	}
+
+	p_roi->SetEntity(NULL);
+	m_pooledROIs.push_back(p_roi);
+	return TRUE;
+}
+
+// Takes a pooled ROI for p_key out of the pool and restores the state CreateActorROI leaves it in
+LegoROI* LegoCharacterManager::ReuseActorROI(const char* p_key)
+{
+	for (vector<LegoROI*>::iterator it = m_pooledROIs.begin(); it != m_pooledROIs.end(); it++) {
+		LegoROI* roi = *it;
+
+		if (!SDL_strcasecmp(roi->GetName(), p_key)) {
+			LegoActorInfo* info = GetActorInfo(p_key);
+			const CompoundObject* comp = roi->GetComp();
+			MxMatrix mat;
+			MxS32 i = 0;
+
+			m_pooledROIs.erase(it);
+
+			for (CompoundObject::const_iterator itc = comp->begin(); itc != comp->end(); itc++, i++) {
+				LegoROI* childROI = (LegoROI*) *itc;
+
+				CalcLocalTransform(
+					Mx3DPointFloat(g_actorLODs[i + 1].m_position),
+					Mx3DPointFloat(g_actorLODs[i + 1].m_direction),
+					Mx3DPointFloat(g_actorLODs[i + 1].m_up),
+					mat
+				);
+				childROI->WrappedSetLocal2WorldWithWorldDataUpdate(mat);
+				childROI->SetVisibility(TRUE);
+
+				SetActorPartLODList(childROI, info->m_parts[i], i);
+			}
+
+			CalcLocalTransform(
+				Mx3DPointFloat(g_actorLODs[c_topLOD].m_position),
+				Mx3DPointFloat(g_actorLODs[c_topLOD].m_direction),
+				Mx3DPointFloat(g_actorLODs[c_topLOD].m_up),
+				mat
+			);
+			roi->WrappedSetLocal2WorldWithWorldDataUpdate(mat);
+
+			info->m_roi = roi;
+			g_actorPoolReuses++;
+			return roi;
+		}
+	}
+
+	if (g_actorPoolCapacity != 0) {
+		g_actorPoolMisses++;
+	}
+
+	return NULL;
+}
+
+void LegoCharacterManager::FlushActorPool()
+{
+	for (vector<LegoROI*>::iterator it = m_pooledROIs.begin(); it != m_pooledROIs.end(); it++) {
+		delete *it;
+	}
+
+	m_pooledROIs.clear();
+}
+
 // FUNCTION: LEGO1 0x100849a0
 // FUNCTION: BETA10 0x10075b51
 MxBool LegoCharacterManager::SetHeadTexture(LegoROI* p_roi, LegoTextureInfo* p_texture)
@@ -656,6 +793,11 @@ MxBool LegoCharacterManager::SetHeadTexture(LegoROI* p_roi, LegoTextureInfo* p_t
 	return head != NULL;
 }
 
+void LegoCharacterManager::configureActorPool(MxU32 p_capacity)
+{
+	g_actorPoolCapacity = p_capacity;
+}
+
 // FUNCTION: LEGO1 0x10084c00
 MxBool LegoCharacterManager::IsActor(const char* p_name)
 {
@@ -797,9 +939,8 @@ MxBool LegoCharacterManager::SwitchColor(LegoROI* p_roi, LegoROI* p_targetROI)
 		part.m_nameIndex = 0;
 	}
 
-	LegoFloat red, green, blue, alpha;
-	LegoROI::GetRGBAColor(part.m_names[part.m_nameIndices[part.m_nameIndex]], red, green, blue, alpha);
-	p_targetROI->SetLodColor(red, green, blue, alpha);
+	// The part's LOD list is shared with other actors, so switch to the list of the new color
+	SetActorPartLODList(p_targetROI, part, partIndex);
 	return TRUE;
 }
 
@@ -36,6 +36,7 @@
 #include "legomain.h"
 #include "legonavcontroller.h"
 #include "legoplantmanager.h"
+#include "legosavewriter.h"
 #include "legostate.h"
 #include "legoutils.h"
 #include "legovideomanager.h"
@@ -183,12 +184,14 @@ LegoGameState::LegoGameState()
 	VariableTable()->SetVariable(m_fullScreenMovie);
 
 	VariableTable()->SetVariable("lightposition", "2");
+	m_saveWriter = new LegoSaveWriter();
 	SerializeScoreHistory(LegoFile::c_read);
 }
 
 // FUNCTION: LEGO1 0x10039720
 LegoGameState::~LegoGameState()
 {
+	delete m_saveWriter;
 	LegoROI::SetColorOverride(NULL);
 
 	if (m_stateCount) {
@@ -275,7 +278,8 @@ MxResult LegoGameState::Save(MxULong p_slot)
 	}
 
 	MxResult result = FAILURE;
-	LegoFile storage;
+	// The state is written to memory here and written to disk by m_saveWriter
+	LegoGrowableMemory* storage = new LegoGrowableMemory();
 	MxVariableTable* variableTable = VariableTable();
 	MxS16 count = 0;
 	MxU32 i;
@@ -285,32 +289,28 @@ MxResult LegoGameState::Save(MxULong p_slot)
 	MxString savePath;
 	GetFileSavePath(&savePath, p_slot);
 
-	if (storage.Open(savePath.GetData(), LegoFile::c_write) == FAILURE) {
-		goto done;
-	}
-
-	storage.WriteS32(0x1000c);
-	storage.WriteS16(m_currentPlayerId);
-	storage.WriteU16(m_currentAct);
-	storage.WriteU8(m_actorId);
+	storage->WriteS32(0x1000c);
+	storage->WriteS16(m_currentPlayerId);
+	storage->WriteU16(m_currentAct);
+	storage->WriteU8(m_actorId);
 
 	for (i = 0; i < sizeOfArray(g_colorSaveData); i++) {
-		if (WriteVariable(&storage, variableTable, g_colorSaveData[i].m_targetName) == FAILURE) {
+		if (WriteVariable(storage, variableTable, g_colorSaveData[i].m_targetName) == FAILURE) {
 			goto done;
 		}
 	}
 
-	if (WriteVariable(&storage, variableTable, "backgroundcolor") == FAILURE) {
+	if (WriteVariable(storage, variableTable, "backgroundcolor") == FAILURE) {
 		goto done;
 	}
-	if (WriteVariable(&storage, variableTable, "lightposition") == FAILURE) {
+	if (WriteVariable(storage, variableTable, "lightposition") == FAILURE) {
 		goto done;
 	}
 
-	WriteEndOfVariables(&storage);
-	CharacterManager()->Write(&storage);
-	PlantManager()->Write(&storage);
-	result = BuildingManager()->Write(&storage);
+	WriteEndOfVariables(storage);
+	CharacterManager()->Write(storage);
+	PlantManager()->Write(storage);
+	result = BuildingManager()->Write(storage);
 
 	for (j = 0; j < m_stateCount; j++) {
 		if (m_stateArray[j]->IsSerializable()) {
@@ -318,20 +318,25 @@ MxResult LegoGameState::Save(MxULong p_slot)
 		}
 	}
 
-	storage.WriteS16(count);
+	storage->WriteS16(count);
 
 	for (j = 0; j < m_stateCount; j++) {
 		if (m_stateArray[j]->IsSerializable()) {
-			m_stateArray[j]->Serialize(&storage);
+			m_stateArray[j]->Serialize(storage);
 		}
 	}
 
 	area = m_savedPreviousArea;
-	storage.WriteU16(area);
+	storage->WriteU16(area);
+
+	m_saveWriter->Queue(savePath.GetData(), storage);
+	storage = NULL;
+
 	SerializeScoreHistory(LegoFile::c_write);
 	m_isDirty = FALSE;
 
 done:
+	delete storage;
 	return result;
 }
 
@@ -369,6 +374,7 @@ MxResult LegoGameState::Load(MxULong p_slot)
 	MxString savePath;
 	GetFileSavePath(&savePath, p_slot);
 
+	WaitForSave();
 	if (storage.Open(savePath.GetData(), LegoFile::c_read) == FAILURE) {
 		goto done;
 	}
@@ -478,6 +484,18 @@ void LegoGameState::SetSavePath(char* p_savePath)
 	}
 }
 
+// Blocks until every queued save file is on disk
+void LegoGameState::WaitForSave()
+{
+	m_saveWriter->Wait();
+}
+
+// p_listener receives a c_notificationSaveComplete for each save file written
+void LegoGameState::SetSaveListener(MxCore* p_listener)
+{
+	m_saveWriter->SetListener(p_listener);
+}
+
 // FUNCTION: LEGO1 0x10039f70
 // FUNCTION: BETA10 0x1008483b
 MxResult LegoGameState::WriteVariable(LegoStorage* p_storage, MxVariableTable* p_from, const char* p_variableName)
@@ -615,6 +633,7 @@ MxResult LegoGameState::AddPlayer(Username& p_player)
 {
 	MxString from, to;
 
+	WaitForSave();
 	if (m_playerCount == 9) {
 		GetFileSavePath(&from, 8);
 		SDL_RemovePath(from.GetData());
@@ -645,6 +664,8 @@ void LegoGameState::SwitchPlayer(MxS16 p_playerId)
 	if (p_playerId > 0) {
 		MxString from, temp, to;
 
+		WaitForSave();
+
 		GetFileSavePath(&from, p_playerId);
 		GetFileSavePath(&temp, 36);
 
@@ -1392,9 +1413,7 @@ LegoGameState::Username::Username()
 MxResult LegoGameState::Username::Serialize(LegoStorage* p_storage)
 {
 	if (p_storage->IsReadMode()) {
-		for (MxS16 i = 0; i < (MxS16) sizeOfArray(m_letters); i++) {
-			p_storage->ReadS16(m_letters[i]);
-		}
+		p_storage->ReadU16s((LegoU16*) m_letters, sizeOfArray(m_letters));
 	}
 	else if (p_storage->IsWriteMode()) {
 		for (MxS16 i = 0; i < (MxS16) sizeOfArray(m_letters); i++) {
@@ -1420,12 +1439,7 @@ MxResult LegoGameState::ScoreItem::Serialize(LegoStorage* p_storage)
 	if (p_storage->IsReadMode()) {
 		p_storage->ReadS16(m_totalScore);
 
-		for (MxS32 i = 0; i < 5; i++) {
-			for (MxS32 j = 0; j < 5; j++) {
-				p_storage->ReadU8(m_scores[i][j]);
-			}
-		}
-
+		p_storage->Read(m_scores, sizeof(m_scores));
 		m_name.Serialize(p_storage);
 		p_storage->ReadS16(m_playerId);
 	}
@@ -1641,10 +1655,16 @@ void LegoGameState::SerializeScoreHistory(MxS16 p_flags)
 
 	if (p_flags == LegoFile::c_write) {
 		m_history.WriteScoreHistory();
-	}
 
-	if (storage.Open(savePath.GetData(), p_flags) == SUCCESS) {
-		m_history.Serialize(&storage);
+		LegoGrowableMemory* snapshot = new LegoGrowableMemory();
+		m_history.Serialize(snapshot);
+		m_saveWriter->Queue(savePath.GetData(), snapshot);
+	}
+	else {
+		WaitForSave();
+		if (storage.Open(savePath.GetData(), p_flags) == SUCCESS) {
+			m_history.Serialize(&storage);
+		}
 	}
 }
 
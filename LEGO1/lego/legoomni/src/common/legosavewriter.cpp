@@ -0,0 +1,195 @@
+#include "legosavewriter.h"
+
+#include "misc/legostorage.h"
+#include "mxmisc.h"
+#include "mxnotificationmanager.h"
+#include "mxticklemanager.h"
+
+#include <SDL3/SDL_filesystem.h>
+#include <SDL3/SDL_iostream.h>
+
+LegoSaveWriter::LegoSaveWriter()
+{
+	m_mutex = SDL_CreateMutex();
+	m_condition = SDL_CreateCondition();
+	m_shutdown = FALSE;
+	m_listener = NULL;
+	m_thread = NULL;
+
+#ifndef __EMSCRIPTEN__
+	// Saves on the web happen from page lifecycle events and must be on disk before returning
+	if (m_mutex && m_condition) {
+		m_thread = new WriteThread(this);
+		if (m_thread->Start(0, 0) != SUCCESS) {
+			delete m_thread;
+			m_thread = NULL;
+		}
+	}
+#endif
+}
+
+LegoSaveWriter::~LegoSaveWriter()
+{
+	if (m_thread) {
+		SDL_LockMutex(m_mutex);
+		m_shutdown = TRUE;
+		SDL_BroadcastCondition(m_condition);
+		SDL_UnlockMutex(m_mutex);
+
+		// Finishes all pending writes before returning
+		m_thread->Terminate();
+		delete m_thread;
+	}
+
+	TickleManager()->UnregisterClient(this);
+
+	while (!m_finished.empty()) {
+		delete m_finished.front();
+		m_finished.pop_front();
+	}
+
+	SDL_DestroyCondition(m_condition);
+	SDL_DestroyMutex(m_mutex);
+}
+
+// Takes ownership of p_data
+MxResult LegoSaveWriter::Queue(const char* p_path, LegoGrowableMemory* p_data)
+{
+	Job* job = new Job;
+	job->m_path = p_path;
+	job->m_path.MapPathToFilesystem();
+	job->m_data = p_data;
+	job->m_result = FAILURE;
+
+	if (m_thread) {
+		SDL_LockMutex(m_mutex);
+		m_pending.push_back(job);
+		SDL_BroadcastCondition(m_condition);
+		SDL_UnlockMutex(m_mutex);
+	}
+	else {
+		Write(job);
+		m_finished.push_back(job);
+	}
+
+	TickleManager()->RegisterClient(this, 0);
+	return SUCCESS;
+}
+
+// Blocks until every queued file has been written
+void LegoSaveWriter::Wait()
+{
+	if (m_thread) {
+		SDL_LockMutex(m_mutex);
+		while (!m_pending.empty()) {
+			SDL_WaitCondition(m_condition, m_mutex);
+		}
+		SDL_UnlockMutex(m_mutex);
+	}
+}
+
+// Reports finished writes to the listener from the main thread
+MxResult LegoSaveWriter::Tickle()
+{
+	list<Job*> finished;
+	MxBool idle;
+
+	if (m_thread) {
+		SDL_LockMutex(m_mutex);
+		finished.splice(finished.end(), m_finished);
+		idle = m_pending.empty();
+		SDL_UnlockMutex(m_mutex);
+	}
+	else {
+		finished.splice(finished.end(), m_finished);
+		idle = TRUE;
+	}
+
+	while (!finished.empty()) {
+		Job* job = finished.front();
+		finished.pop_front();
+
+		if (m_listener) {
+			NotificationManager()->Send(m_listener, LegoSaveNotificationParam(job->m_result));
+		}
+
+		delete job;
+	}
+
+	if (idle) {
+		TickleManager()->UnregisterClient(this);
+	}
+
+	return SUCCESS;
+}
+
+MxResult LegoSaveWriter::WriteFile(const char* p_path, LegoGrowableMemory* p_data)
+{
+	MxString tempPath(p_path);
+	tempPath += ".tmp";
+
+	SDL_IOStream* file = SDL_IOFromFile(tempPath.GetData(), "wb");
+	if (!file) {
+		return FAILURE;
+	}
+
+	MxBool written = SDL_WriteIO(file, p_data->GetData(), p_data->GetSize()) == p_data->GetSize();
+	written = SDL_FlushIO(file) && written;
+
+	if (!SDL_CloseIO(file) || !written || !SDL_RenamePath(tempPath.GetData(), p_path)) {
+		SDL_RemovePath(tempPath.GetData());
+		return FAILURE;
+	}
+
+	return SUCCESS;
+}
+
+void LegoSaveWriter::Write(Job* p_job)
+{
+	p_job->m_result = WriteFile(p_job->m_path.GetData(), p_job->m_data);
+	delete p_job->m_data;
+	p_job->m_data = NULL;
+
+	if (p_job->m_result != SUCCESS) {
+		SDL_LogError(
+			SDL_LOG_CATEGORY_APPLICATION,
+			"Failed to write save file %s: %s",
+			p_job->m_path.GetData(),
+			SDL_GetError()
+		);
+	}
+}
+
+// Writes the oldest pending file. Returns FALSE once shut down with nothing left to write.
+MxBool LegoSaveWriter::WriteNext()
+{
+	SDL_LockMutex(m_mutex);
+	while (m_pending.empty() && !m_shutdown) {
+		SDL_WaitCondition(m_condition, m_mutex);
+	}
+
+	if (m_pending.empty()) {
+		SDL_UnlockMutex(m_mutex);
+		return FALSE;
+	}
+
+	Job* job = m_pending.front();
+	SDL_UnlockMutex(m_mutex);
+
+	Write(job);
+
+	SDL_LockMutex(m_mutex);
+	m_pending.pop_front();
+	m_finished.push_back(job);
+	SDL_BroadcastCondition(m_condition);
+	SDL_UnlockMutex(m_mutex);
+	return TRUE;
+}
+
+MxResult LegoSaveWriter::WriteThread::Run()
+{
+	while (m_writer->WriteNext()) {
+	}
+
+	return MxThread::Run();
+}
@@ -38,12 +38,24 @@ MxS32 g_legoWorldPresenterQuality = 1;
 // GLOBAL: LEGO1 0x100f75d8
 Sint64 g_wdbSkipGlobalPartsOffset = 0;
 
+// The world.wdb index, read the first time a world is loaded and kept for later loads
+static ModelDbWorld* g_modelDbWorlds = NULL;
+static MxS32 g_numModelDbWorlds = 0;
+static Sint64 g_wdbIndexEndOffset = 0;
+
 // FUNCTION: LEGO1 0x100665b0
 void LegoWorldPresenter::configureLegoWorldPresenter(MxS32 p_legoWorldPresenterQuality)
 {
 	g_legoWorldPresenterQuality = p_legoWorldPresenterQuality;
 }
 
+// Frees the world.wdb index kept between world loads
+void LegoWorldPresenter::ReleaseModelDb()
+{
+	FreeModelDbWorlds(g_modelDbWorlds, g_numModelDbWorlds);
+	g_numModelDbWorlds = 0;
+}
+
 // FUNCTION: LEGO1 0x100665c0
 LegoWorldPresenter::LegoWorldPresenter()
 {
@@ -191,12 +203,21 @@ MxResult LegoWorldPresenter::LoadWorld(char* p_worldName, LegoWorld* p_world)
 		}
 	}
 
-	ModelDbWorld* worlds = NULL;
-	MxS32 numWorlds, i, j;
+	MxS32 i, j;
 	MxU32 size;
 	MxU8* buff;
 
-	ReadModelDbWorlds(wdbFile, worlds, numWorlds);
+	if (g_modelDbWorlds == NULL) {
+		if (ReadModelDbWorlds(wdbFile, g_modelDbWorlds, g_numModelDbWorlds) != SUCCESS) {
+			SDL_CloseIO(wdbFile);
+			return FAILURE;
+		}
+
+		g_wdbIndexEndOffset = SDL_TellIO(wdbFile);
+	}
+
+	ModelDbWorld* worlds = g_modelDbWorlds;
+	MxS32 numWorlds = g_numModelDbWorlds;
 
 	for (i = 0; i < numWorlds; i++) {
 		if (!SDL_strcasecmp(worlds[i].m_worldName, p_worldName)) {
@@ -209,6 +230,11 @@ MxResult LegoWorldPresenter::LoadWorld(char* p_worldName, LegoWorld* p_world)
 	}
 
 	if (g_wdbSkipGlobalPartsOffset == 0) {
+		// The global parts follow the index
+		if (SDL_SeekIO(wdbFile, g_wdbIndexEndOffset, SDL_IO_SEEK_SET) != g_wdbIndexEndOffset) {
+			return FAILURE;
+		}
+
 		if (SDL_ReadIO(wdbFile, &size, sizeof(MxU32)) != sizeof(MxU32)) {
 			return FAILURE;
 		}
@@ -312,7 +338,6 @@ MxResult LegoWorldPresenter::LoadWorld(char* p_worldName, LegoWorld* p_world)
 		}
 	}
 
-	FreeModelDbWorlds(worlds, numWorlds);
 	SDL_CloseIO(wdbFile);
 	return SUCCESS;
 }
@@ -16,6 +16,7 @@
 #include "legovideomanager.h"
 #include "legoworld.h"
 #include "legoworldlist.h"
+#include "legoworldpresenter.h"
 #include "misc.h"
 #include "misc/legocontainer.h"
 #include "mxactionnotificationparam.h"
@@ -130,6 +131,7 @@ void LegoOmni::Destroy()
 	}
 
 	LegoPartPresenter::Release();
+	LegoWorldPresenter::ReleaseModelDb();
 
 	if (m_viewLODListManager) {
 		delete m_viewLODListManager;
@@ -478,21 +478,19 @@ MxU32 LegoPathActor::VTable0x6c(
 	}
 
 	LegoPathActorSet& plpas = p_boundary->GetActors();
-	LegoPathActorSet lpas(plpas);
 
-	for (LegoPathActorSet::iterator itpa = lpas.begin(); itpa != lpas.end(); itpa++) {
-		if (plpas.find(*itpa) != plpas.end()) {
-			LegoPathActor* actor = *itpa;
+	// Any hit returns right away, so nothing below can change the set while it is walked
+	for (LegoPathActorSet::iterator itpa = plpas.begin(); itpa != plpas.end(); itpa++) {
+		LegoPathActor* actor = *itpa;
 
-			if (this != actor && !(actor->GetActorState() & LegoPathActor::c_noCollide)) {
-				LegoROI* roi = actor->GetROI();
+		if (this != actor && !(actor->GetActorState() & LegoPathActor::c_noCollide)) {
+			LegoROI* roi = actor->GetROI();
 
-				if (roi != NULL && (roi->GetVisibility() || actor->GetCameraFlag())) {
-					if (roi->FUN_100a9410(p_v1, p_v2, p_f1, p_f2, p_v3, m_collideBox && actor->m_collideBox)) {
-						HitActor(actor, TRUE);
-						actor->HitActor(this, FALSE);
-						return 2;
-					}
+			if (roi != NULL && (roi->GetVisibility() || actor->GetCameraFlag())) {
+				if (roi->FUN_100a9410(p_v1, p_v2, p_f1, p_f2, p_v3, m_collideBox && actor->m_collideBox)) {
+					HitActor(actor, TRUE);
+					actor->HitActor(this, FALSE);
+					return 2;
 				}
 			}
 		}
@@ -502,7 +500,7 @@ MxU32 LegoPathActor::VTable0x6c(
 }
 
 inline MxU32 LegoPathActor::FUN_1002edd0(
-	list<LegoPathBoundary*>& p_boundaries,
+	vector<LegoPathBoundary*>& p_boundaries,
 	LegoPathBoundary* p_boundary,
 	Vector3& p_v1,
 	Vector3& p_v2,
@@ -530,9 +528,9 @@ inline MxU32 LegoPathActor::FUN_1002edd0(
 		LegoPathBoundary* boundary = (LegoPathBoundary*) edge->OtherFace(p_boundary);
 
 		if (boundary != NULL) {
-			list<LegoPathBoundary*>::const_iterator it;
+			vector<LegoPathBoundary*>::const_iterator it;
 
-			for (it = p_boundaries.begin(); !(it == p_boundaries.end()); it++) {
+			for (it = p_boundaries.begin(); it != p_boundaries.end(); it++) {
 				if ((*it) == boundary) {
 					break;
 				}
@@ -570,7 +568,10 @@ MxS32 LegoPathActor::VTable0x68(Vector3& p_v1, Vector3& p_v2, Vector3& p_v3)
 	v2 /= len;
 
 	float radius = m_roi->GetWorldBoundingSphere().Radius();
-	list<LegoPathBoundary*> boundaries;
+	// At most two levels of neighbours are visited, so a small vector is enough to track them
+	// without allocating a list node per boundary on every movement query.
+	vector<LegoPathBoundary*> boundaries;
+	boundaries.reserve(16);
 
 	return FUN_1002edd0(boundaries, m_boundary, p_v1, v2, len, radius, p_v3, 0);
 }
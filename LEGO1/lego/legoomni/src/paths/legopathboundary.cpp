@@ -63,6 +63,10 @@ void LegoPathBoundary::CheckAndCallPathTriggers(Vector3& p_from, Vector3& p_to,
 		float dot2 = v.Dot(v, *m_direction);
 
 		if (dot2 > dot1) {
+			if (m_maxTriggerLength < dot1 || m_minTriggerLength >= dot2) {
+				return;
+			}
+
 			for (MxS32 i = 0; i < m_numTriggers; i++) {
 				LegoPathStruct* s = m_pathTrigger[i].m_pathStruct;
 
@@ -72,6 +76,10 @@ void LegoPathBoundary::CheckAndCallPathTriggers(Vector3& p_from, Vector3& p_to,
 			}
 		}
 		else if (dot2 < dot1) {
+			if (m_maxTriggerLength < dot2 || m_minTriggerLength >= dot1) {
+				return;
+			}
+
 			for (MxS32 i = 0; i < m_numTriggers; i++) {
 				LegoPathStruct* s = m_pathTrigger[i].m_pathStruct;
 
@@ -67,6 +67,11 @@ LegoPathController::CtrlBoundary* LegoPathController::g_ctrlBoundariesB = NULL;
 // GLOBAL: LEGO1 0x100f435c
 LegoPathController::CtrlEdge* LegoPathController::g_ctrlEdgesB = NULL;
 
+// Length of a simulation step in milliseconds, 0 to animate once per tickle
+MxFloat LegoPathController::g_simulationStep = 0.0f;
+
+MxU32 LegoPathController::g_maxSimulationSteps = 4;
+
 // FUNCTION: LEGO1 0x10044f40
 // FUNCTION: BETA10 0x100b6860
 LegoPathController::LegoPathController()
@@ -79,6 +84,11 @@ LegoPathController::LegoPathController()
 	m_numE = 0;
 	m_numN = 0;
 	m_numT = 0;
+	m_edgeVisitGeneration = 0;
+	m_numUnvisitedEdges = 0;
+	m_ticking = FALSE;
+	m_tickLast = NULL;
+	m_simulationTime = -1.0f;
 }
 
 // FUNCTION: LEGO1 0x10045880
@@ -150,6 +160,7 @@ void LegoPathController::Destroy()
 	}
 	m_boundaries = NULL;
 	m_numL = 0;
+	m_boundaryNames.clear();
 
 	if (m_nodes != NULL) {
 		delete[] m_nodes;
@@ -168,6 +179,7 @@ void LegoPathController::Destroy()
 	}
 	m_edges = NULL;
 	m_numE = 0;
+	m_edgeVisits.clear();
 
 	MxS32 j;
 	for (j = 0; j < sizeOfArray(g_unk0x100f42f0); j++) {
@@ -239,7 +251,7 @@ MxResult LegoPathController::PlaceActor(
 	}
 
 	p_actor->SetController(this);
-	m_actors.insert(p_actor);
+	InsertActor(p_actor);
 	return SUCCESS;
 }
 
@@ -307,7 +319,7 @@ MxResult LegoPathController::PlaceActor(
 
 			if (p_actor->VTable0x84(boundary, time, p_position, p_direction, edge, 0.5f) == SUCCESS) {
 				p_actor->SetController(this);
-				m_actors.insert(p_actor);
+				InsertActor(p_actor);
 				return SUCCESS;
 			}
 		}
@@ -325,7 +337,7 @@ MxResult LegoPathController::PlaceActor(LegoPathActor* p_actor)
 		p_actor->SetController(NULL);
 	}
 
-	m_actors.insert(p_actor);
+	InsertActor(p_actor);
 	p_actor->SetController(this);
 	return SUCCESS;
 }
@@ -337,7 +349,7 @@ MxResult LegoPathController::RemoveActor(LegoPathActor* p_actor)
 	MxResult result = FAILURE;
 
 	p_actor->VTable0xc4();
-	m_actors.erase(p_actor);
+	EraseActor(p_actor);
 
 	for (MxS32 i = 0; i < m_numL; i++) {
 		if (m_boundaries[i].RemoveActor(p_actor) == SUCCESS) {
@@ -374,17 +386,120 @@ void LegoPathController::FUN_10046970()
 {
 	float time = Timer()->GetTime();
 
-	LegoPathActorSet lpas(m_actors);
+	if (g_simulationStep <= 0.0f || m_simulationTime < 0.0f || time < m_simulationTime) {
+		m_simulationTime = time;
+		AnimateActors(time, FALSE);
+		return;
+	}
 
-	for (LegoPathActorSet::iterator itpa = lpas.begin(); itpa != lpas.end(); itpa++) {
-		LegoPathActor* actor = *itpa;
+	// Step the actors at a fixed rate, carrying the remainder over to the next tickle.
+	// After a long frame the last allowed step catches up to the timer in one go.
+	MxU32 steps = (time - m_simulationTime) / g_simulationStep;
 
-		if (m_actors.find(actor) != m_actors.end()) {
-			if (!((MxU8) actor->GetActorState() & LegoPathActor::c_disabled)) {
-				actor->Animate(time);
-			}
+	for (MxU32 i = 1; i <= steps; i++) {
+		if (i == g_maxSimulationSteps) {
+			m_simulationTime = time;
+			AnimateActors(time, TRUE);
+			break;
+		}
+
+		m_simulationTime += g_simulationStep;
+		AnimateActors(m_simulationTime, TRUE);
+	}
+}
+
+// With p_stepped set, p_time may lag the timer by up to one step. Actors that reset their
+// clock from the timer in the meantime are skipped until the simulation catches up with
+// them, as animating them backwards in time would move them backwards along their path.
+void LegoPathController::AnimateActors(float p_time, MxBool p_stepped)
+{
+	// Walk m_actors in place, the same as iterating over a copy of the set: actors erased
+	// before they are reached are skipped, actors inserted during the walk are not animated
+	// and actors erased and inserted again before they are reached are still animated.
+	m_ticking = TRUE;
+	m_tickLast = NULL;
+	m_tickAdded.clear();
+	m_tickRemoved.clear();
+
+	for (m_tickNext = m_actors.begin(); m_tickNext != m_actors.end();) {
+		LegoPathActor* actor = *m_tickNext++;
+		m_tickLast = actor;
+
+		if (!m_tickAdded.empty() && find(m_tickAdded.begin(), m_tickAdded.end(), actor) != m_tickAdded.end()) {
+			continue;
+		}
+
+		if (p_stepped && p_time < actor->GetLastTime()) {
+			continue;
+		}
+
+		if (!((MxU8) actor->GetActorState() & LegoPathActor::c_disabled)) {
+			actor->Animate(p_time);
 		}
 	}
+
+	m_ticking = FALSE;
+}
+
+// Simulation rate in Hz, 0 to animate path actors once per tickle
+void LegoPathController::configureSimulation(MxFloat p_rate, MxU32 p_maxSteps)
+{
+	g_simulationStep = p_rate > 0.0f ? 1000.0f / p_rate : 0.0f;
+	g_maxSimulationSteps = p_maxSteps > 0 ? p_maxSteps : 1;
+}
+
+void LegoPathController::InsertActor(LegoPathActor* p_actor)
+{
+	pair<LegoPathActorSet::iterator, bool> inserted = m_actors.insert(p_actor);
+
+	if (!inserted.second || !m_ticking) {
+		return;
+	}
+
+	// An actor that was part of the current walk and comes back is still part of it
+	vector<LegoPathActor*>::iterator it = find(m_tickRemoved.begin(), m_tickRemoved.end(), p_actor);
+
+	if (it != m_tickRemoved.end()) {
+		m_tickRemoved.erase(it);
+
+		// If it was erased as the next actor of the walk, EraseActor moved m_tickNext past it.
+		// Move it back so the actor is still reached.
+		LegoPathActorSetCompare compare;
+
+		if ((m_tickLast == NULL || compare(m_tickLast, p_actor)) &&
+			(m_tickNext == m_actors.end() || compare(p_actor, *m_tickNext))) {
+			m_tickNext = inserted.first;
+		}
+	}
+	else {
+		m_tickAdded.push_back(p_actor);
+	}
+}
+
+void LegoPathController::EraseActor(LegoPathActor* p_actor)
+{
+	LegoPathActorSet::iterator itpa = m_actors.find(p_actor);
+
+	if (itpa == m_actors.end()) {
+		return;
+	}
+
+	if (m_ticking) {
+		if (itpa == m_tickNext) {
+			m_tickNext++;
+		}
+
+		vector<LegoPathActor*>::iterator it = find(m_tickAdded.begin(), m_tickAdded.end(), p_actor);
+
+		if (it != m_tickAdded.end()) {
+			m_tickAdded.erase(it);
+		}
+		else {
+			m_tickRemoved.push_back(p_actor);
+		}
+	}
+
+	m_actors.erase(itpa);
 }
 
 // FUNCTION: LEGO1 0x10046b30
@@ -399,10 +514,10 @@ MxResult LegoPathController::FUN_10046b30(LegoPathBoundary*& p_boundaries, MxS32
 // FUNCTION: BETA10 0x100b7531
 LegoPathBoundary* LegoPathController::GetPathBoundary(const char* p_name)
 {
-	for (MxS32 i = 0; i < m_numL; i++) {
-		if (!SDL_strcasecmp(m_boundaries[i].GetName(), p_name)) {
-			return &m_boundaries[i];
-		}
+	LegoPathBoundaryNameMap::iterator it = m_boundaryNames.find(p_name);
+
+	if (it != m_boundaryNames.end()) {
+		return (*it).second;
 	}
 
 	return NULL;
@@ -519,6 +634,9 @@ MxResult LegoPathController::Read(LegoStorage* p_storage)
 		m_pfsE.insert(&m_edges[j]);
 	}
 
+	m_edgeVisits.assign(m_numE, 0);
+	m_edgeVisitGeneration = 0;
+
 	return SUCCESS;
 }
 
@@ -735,6 +853,13 @@ MxResult LegoPathController::ReadBoundaries(LegoStorage* p_storage)
 			if (ReadVector(p_storage, *boundary.m_direction) != SUCCESS) {
 				return FAILURE;
 			}
+
+			boundary.UpdateTriggerRange();
+		}
+
+		// The first of several boundaries with the same name wins, as with the linear search
+		if (boundary.m_name != NULL) {
+			m_boundaryNames.insert(LegoPathBoundaryNameMap::value_type(boundary.m_name, &boundary));
 		}
 	}
 
@@ -793,7 +918,8 @@ MxResult LegoPathController::FUN_10048310(
 	LegoBEWithFloatSet::iterator boundarySetItA;
 	LegoBEWithFloatSet::iterator boundarySetItB;
 
-	LegoPathCtrlEdgeSet pathCtrlEdgeSet(m_pfsE);
+	// Stands in for the original copy of m_pfsE, see VisitEdge()
+	ResetEdgeVisits();
 
 	MxFloat local14 = 999999.0f;
 
@@ -824,11 +950,11 @@ MxResult LegoPathController::FUN_10048310(
 			}
 		}
 
-		pathCtrlEdgeSet.erase(edge);
+		VisitEdge(edge);
 	}
 
 	if (!p_grec->GetBit1()) {
-		while (pathCtrlEdgeSet.size() > 0) {
+		while (m_numUnvisitedEdges > 0) {
 			LegoBEWithFloat edgeWithFloat;
 			MxFloat local70 = 999999.0f;
 
@@ -881,7 +1007,7 @@ MxResult LegoPathController::FUN_10048310(
 							LegoPathCtrlEdge* edge = (LegoPathCtrlEdge*) bOther->GetEdges()[i];
 
 							if (edge->GetMask0x03()) {
-								if (pathCtrlEdgeSet.find(edge) != pathCtrlEdgeSet.end()) {
+								if (IsEdgeUnvisited(edge)) {
 									shouldRemove = FALSE;
 
 									float dist;
@@ -910,7 +1036,7 @@ MxResult LegoPathController::FUN_10048310(
 			}
 
 			if (edgeWithFloat.m_edge != NULL) {
-				pathCtrlEdgeSet.erase(edgeWithFloat.m_edge);
+				VisitEdge(edgeWithFloat.m_edge);
 				boundaryList.push_back(edgeWithFloat);
 				boundarySet.insert(&boundaryList.back());
 			}
@@ -951,6 +1077,16 @@ MxResult LegoPathController::FUN_10048310(
 	return FAILURE;
 }
 
+void LegoPathController::ResetEdgeVisits()
+{
+	if (++m_edgeVisitGeneration == 0) {
+		m_edgeVisits.assign(m_numE, 0);
+		m_edgeVisitGeneration = 1;
+	}
+
+	m_numUnvisitedEdges = m_numE;
+}
+
 // FUNCTION: LEGO1 0x1004a240
 // FUNCTION: BETA10 0x100b9160
 MxS32 LegoPathController::FUN_1004a240(
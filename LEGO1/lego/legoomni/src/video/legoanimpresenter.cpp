@@ -1298,6 +1298,18 @@ void LegoLoopingAnimPresenter::PutFrame()
 	}
 }
 
+MxResult LegoLoopingAnimPresenter::CreateAnim(MxStreamChunk* p_chunk)
+{
+	MxResult result = LegoAnimPresenter::CreateAnim(p_chunk);
+
+	// Looping clips are replayed unchanged, often by several actors at once
+	if (result == SUCCESS) {
+		m_anim->SetUsePoseCache(TRUE);
+	}
+
+	return result;
+}
+
 // FUNCTION: LEGO1 0x1006cdd0
 LegoLocomotionAnimPresenter::LegoLocomotionAnimPresenter()
 {
@@ -1347,7 +1359,7 @@ void LegoLocomotionAnimPresenter::Destroy(MxBool p_fromDestructor)
 // FUNCTION: LEGO1 0x1006d140
 MxResult LegoLocomotionAnimPresenter::CreateAnim(MxStreamChunk* p_chunk)
 {
-	MxResult result = LegoAnimPresenter::CreateAnim(p_chunk);
+	MxResult result = LegoLoopingAnimPresenter::CreateAnim(p_chunk);
 	return result == SUCCESS ? SUCCESS : result;
 }
 
@@ -4,6 +4,7 @@
 #include "mxgeometry/mxquaternion.h"
 
 #include <limits.h>
+#include <string.h>
 
 DECOMP_SIZE_ASSERT(LegoAnimKey, 0x08)
 DECOMP_SIZE_ASSERT(LegoTranslationKey, 0x14)
@@ -16,6 +17,13 @@ DECOMP_SIZE_ASSERT(LegoAnimActorEntry, 0x08)
 DECOMP_SIZE_ASSERT(LegoAnimScene, 0x24)
 DECOMP_SIZE_ASSERT(LegoAnim, 0x18)
 
+// Pose cache settings and counters, see LegoAnimNodeData::SampleLocalTransform
+LegoFloat g_poseCacheQuantum = 10.0f;
+LegoU32 g_poseCacheBudget = 4 * 1024 * 1024;
+LegoU32 g_poseCacheHits = 0;
+LegoU32 g_poseCacheMisses = 0;
+LegoU32 g_poseCacheSize = 0;
+
 // FUNCTION: LEGO1 0x1009f000
 LegoRotationZKey::LegoRotationZKey()
 {
@@ -544,6 +552,8 @@ LegoAnimNodeData::LegoAnimNodeData()
 	m_rotationIndex = 0;
 	m_scaleIndex = 0;
 	m_morphIndex = 0;
+	m_usePoseCache = FALSE;
+	m_poseSamples = NULL;
 }
 
 // FUNCTION: LEGO1 0x1009fda0
@@ -564,6 +574,10 @@ LegoAnimNodeData::~LegoAnimNodeData()
 	if (m_morphKeys) {
 		delete[] m_morphKeys;
 	}
+	if (m_poseSamples) {
+		delete[] m_poseSamples;
+		g_poseCacheSize -= c_numPoseSamples * sizeof(LegoPoseSample);
+	}
 }
 
 // FUNCTION: LEGO1 0x1009fe60
@@ -572,6 +586,8 @@ LegoResult LegoAnimNodeData::Read(LegoStorage* p_storage)
 {
 	LegoResult result;
 
+	FlushPoseCache();
+
 	LegoU32 length;
 	if ((result = p_storage->Read(&length, sizeof(LegoU32))) != SUCCESS) {
 		return result;
@@ -775,6 +791,78 @@ LegoResult LegoAnimNodeData::CreateLocalTransform(LegoFloat p_time, Matrix4& p_m
 	return SUCCESS;
 }
 
+// Replaces p_matrix with the local transform at p_time rounded to the pose cache quantum.
+// Looping cycles revisit the same samples on every loop, and actors that play the same
+// clip in step share them, so most frames skip the key lookups and the slerp entirely.
+LegoResult LegoAnimNodeData::SampleLocalTransform(LegoFloat p_time, Matrix4& p_matrix)
+{
+	p_matrix.SetIdentity();
+
+	if (!m_usePoseCache || g_poseCacheQuantum <= 0.0f || p_time < 0.0f) {
+		return CreateLocalTransform(p_time, p_matrix);
+	}
+
+	if (m_poseSamples == NULL) {
+		LegoU32 size = c_numPoseSamples * sizeof(LegoPoseSample);
+
+		if (g_poseCacheSize + size > g_poseCacheBudget) {
+			return CreateLocalTransform(p_time, p_matrix);
+		}
+
+		m_poseSamples = new LegoPoseSample[c_numPoseSamples];
+		g_poseCacheSize += size;
+		FlushPoseCache();
+	}
+
+	LegoS32 tick = (LegoS32) (p_time / g_poseCacheQuantum + 0.5f);
+	LegoPoseSample& sample = m_poseSamples[tick % c_numPoseSamples];
+
+	if (sample.m_tick == tick) {
+		p_matrix.CopyFrom(sample.m_matrix);
+		g_poseCacheHits++;
+		return SUCCESS;
+	}
+
+	g_poseCacheMisses++;
+	CreateLocalTransform(tick * g_poseCacheQuantum, p_matrix);
+
+	memcpy(sample.m_matrix, p_matrix.GetData(), sizeof(sample.m_matrix));
+	sample.m_tick = tick;
+	return SUCCESS;
+}
+
+void LegoAnimNodeData::FlushPoseCache()
+{
+	if (m_poseSamples != NULL) {
+		for (LegoU32 i = 0; i < c_numPoseSamples; i++) {
+			m_poseSamples[i].m_tick = -1;
+		}
+	}
+}
+
+// Sets the sampling interval in milliseconds (0 disables the cache) and the number of
+// bytes all nodes may use for samples together. Meant to be called once at startup.
+void LegoAnimNodeData::configurePoseCache(LegoFloat p_quantum, LegoU32 p_budget)
+{
+	g_poseCacheQuantum = p_quantum;
+	g_poseCacheBudget = p_budget;
+}
+
+LegoU32 LegoAnimNodeData::GetPoseCacheHits()
+{
+	return g_poseCacheHits;
+}
+
+LegoU32 LegoAnimNodeData::GetPoseCacheMisses()
+{
+	return g_poseCacheMisses;
+}
+
+LegoU32 LegoAnimNodeData::GetPoseCacheSize()
+{
+	return g_poseCacheSize;
+}
+
 // FUNCTION: LEGO1 0x100a0600
 inline void LegoAnimNodeData::GetTranslation(
 	LegoU16 p_numTranslationKeys,
@@ -985,10 +1073,23 @@ LegoU32 LegoAnimNodeData::FindKeys(
 			}
 		}
 		else {
-			for (p_new_index = 0;
-				 p_new_index < p_numKeys - 1 && p_time >= GetKey(p_new_index + 1, p_keys, p_size).GetTime();
-				 p_new_index++) {
+			// Time went backwards, usually because a looping animation restarted. Keys are sorted by
+			// time, so bisect for the last key at or before p_time instead of scanning from the start.
+			LegoU32 low = 0;
+			LegoU32 high = p_numKeys - 1;
+
+			while (low < high) {
+				LegoU32 mid = (low + high + 1) / 2;
+
+				if (p_time >= GetKey(mid, p_keys, p_size).GetTime()) {
+					low = mid;
+				}
+				else {
+					high = mid - 1;
+				}
 			}
+
+			p_new_index = low;
 		}
 
 		p_old_index = p_new_index;
@@ -1159,6 +1260,23 @@ LegoResult LegoAnim::Write(LegoStorage* p_storage)
 	return result;
 }
 
+static void SetNodeUsePoseCache(LegoTreeNode* p_node, LegoBool p_usePoseCache)
+{
+	((LegoAnimNodeData*) p_node->GetData())->SetUsePoseCache(p_usePoseCache);
+
+	for (LegoU32 i = 0; i < p_node->GetNumChildren(); i++) {
+		SetNodeUsePoseCache(p_node->GetChild(i), p_usePoseCache);
+	}
+}
+
+// Lets the nodes of this animation share sampled poses, only for clips whose keys never change
+void LegoAnim::SetUsePoseCache(LegoBool p_usePoseCache)
+{
+	if (GetRoot() != NULL) {
+		SetNodeUsePoseCache(GetRoot(), p_usePoseCache);
+	}
+}
+
 // FUNCTION: LEGO1 0x100a0f20
 // FUNCTION: BETA10 0x101801fd
 const LegoChar* LegoAnim::GetActorName(LegoU32 p_index)
@@ -2,6 +2,7 @@
 #define __LEGOANIM_H
 
 #include "decomp.h"
+#include "lego1_export.h"
 #include "misc/legostorage.h"
 #include "misc/legotree.h"
 
@@ -149,10 +150,20 @@ class LegoRotationZKey : public LegoAnimKey {
 	LegoFloat m_z; // 0x08
 };
 
+// A local transform sampled at a multiple of the pose cache quantum
+struct LegoPoseSample {
+	LegoS32 m_tick;
+	LegoFloat m_matrix[4][4];
+};
+
 // VTABLE: LEGO1 0x100db8c8
 // SIZE 0x34
 class LegoAnimNodeData : public LegoTreeNodeData {
 public:
+	enum {
+		c_numPoseSamples = 128
+	};
+
 	LegoAnimNodeData();
 	~LegoAnimNodeData() override;
 	LegoResult Read(LegoStorage* p_storage) override;  // vtable+0x04
@@ -160,8 +171,17 @@ class LegoAnimNodeData : public LegoTreeNodeData {
 
 	void SetName(LegoChar* p_name);
 	LegoResult CreateLocalTransform(LegoFloat p_time, Matrix4& p_matrix);
+	LegoResult SampleLocalTransform(LegoFloat p_time, Matrix4& p_matrix);
 	LegoBool GetVisibility(LegoFloat p_time);
 
+	void SetUsePoseCache(LegoBool p_usePoseCache) { m_usePoseCache = p_usePoseCache; }
+	void FlushPoseCache();
+
+	LEGO1_EXPORT static void configurePoseCache(LegoFloat p_quantum, LegoU32 p_budget);
+	static LegoU32 GetPoseCacheHits();
+	static LegoU32 GetPoseCacheMisses();
+	static LegoU32 GetPoseCacheSize();
+
 	// FUNCTION: BETA10 0x100595d0
 	LegoChar* GetName() { return m_name; }
 
@@ -179,6 +199,7 @@ class LegoAnimNodeData : public LegoTreeNodeData {
 	{
 		m_rotationKeys = p_keys;
 		m_rotationIndex = 0;
+		FlushPoseCache();
 	}
 
 	LegoU32 GetTranslationIndex() { return m_translationIndex; }
@@ -285,6 +306,10 @@ class LegoAnimNodeData : public LegoTreeNodeData {
 	LegoU32 m_rotationIndex;               // 0x28
 	LegoU32 m_scaleIndex;                  // 0x2c
 	LegoU32 m_morphIndex;                  // 0x30
+
+	// Samples shared by every actor that plays this node, see SampleLocalTransform
+	LegoBool m_usePoseCache;
+	LegoPoseSample* m_poseSamples;
 };
 
 // SIZE 0x08
@@ -351,6 +376,8 @@ class LegoAnim : public LegoTree {
 	// FUNCTION: BETA10 0x1005abf0
 	LegoAnimScene* GetCamAnim() { return m_camAnim; }
 
+	void SetUsePoseCache(LegoBool p_usePoseCache);
+
 	// SYNTHETIC: LEGO1 0x100a0ba0
 	// LegoAnim::`scalar deleting destructor'
 
@@ -19,6 +19,8 @@ LegoWEGEdge::LegoWEGEdge()
 	m_numTriggers = 0;
 	m_pathTrigger = NULL;
 	m_direction = NULL;
+	m_minTriggerLength = 0.0f;
+	m_maxTriggerLength = 0.0f;
 }
 
 // FUNCTION: LEGO1 0x1009a800
@@ -212,11 +214,32 @@ LegoS32 LegoWEGEdge::LinkEdgesAndFaces()
 		else {
 			result = -5;
 		}
+
+		UpdateTriggerRange();
 	}
 
 	return result;
 }
 
+void LegoWEGEdge::UpdateTriggerRange()
+{
+	if (m_numTriggers == 0) {
+		return;
+	}
+
+	m_minTriggerLength = m_maxTriggerLength = m_pathTrigger[0].m_triggerLength;
+
+	for (LegoS32 j = 1; j < m_numTriggers; j++) {
+		if (m_pathTrigger[j].m_triggerLength < m_minTriggerLength) {
+			m_minTriggerLength = m_pathTrigger[j].m_triggerLength;
+		}
+
+		if (m_pathTrigger[j].m_triggerLength > m_maxTriggerLength) {
+			m_maxTriggerLength = m_pathTrigger[j].m_triggerLength;
+		}
+	}
+}
+
 // FUNCTION: LEGO1 0x1009aea0
 // FUNCTION: BETA10 0x10183e2a
 LegoS32 LegoWEGEdge::ValidateFacePlanarity()
@@ -88,6 +88,7 @@ class LegoWEGEdge : public LegoWEEdge {
 
 protected:
 	LegoS32 ValidateFacePlanarity();
+	void UpdateTriggerRange();
 
 	LegoU8 m_flags;                 // 0x0c
 	LegoU8 m_unk0x0d;               // 0x0d
@@ -99,6 +100,10 @@ class LegoWEGEdge : public LegoWEEdge {
 	LegoU8 m_numTriggers;           // 0x48
 	PathWithTrigger* m_pathTrigger; // 0x4c
 	Mx3DPointFloat* m_direction;    // 0x50
+
+	// Range of m_pathTrigger[].m_triggerLength, lets a move that crosses none of them skip the scan
+	float m_minTriggerLength;
+	float m_maxTriggerLength;
 };
 
 #endif // __LEGOWEGEDGE_H
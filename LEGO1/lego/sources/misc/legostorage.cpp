@@ -2,6 +2,7 @@
 
 #include "decomp.h"
 
+#include <SDL3/SDL_log.h>
 #include <memory.h>
 #include <string.h>
 
@@ -35,18 +36,73 @@ LegoResult LegoMemory::Write(const void* p_buffer, LegoU32 p_size)
 	return SUCCESS;
 }
 
+LegoGrowableMemory::LegoGrowableMemory() : LegoStorage()
+{
+	m_mode = c_write;
+	m_buffer = NULL;
+	m_position = 0;
+	m_size = 0;
+	m_capacity = 0;
+}
+
+LegoGrowableMemory::~LegoGrowableMemory()
+{
+	delete[] m_buffer;
+}
+
+LegoResult LegoGrowableMemory::Read(void* p_buffer, LegoU32 p_size)
+{
+	if (m_position + p_size > m_size) {
+		return FAILURE;
+	}
+	memcpy(p_buffer, m_buffer + m_position, p_size);
+	m_position += p_size;
+	return SUCCESS;
+}
+
+LegoResult LegoGrowableMemory::Write(const void* p_buffer, LegoU32 p_size)
+{
+	if (m_position + p_size > m_capacity) {
+		LegoU32 capacity = m_capacity ? m_capacity : 0x1000;
+		while (capacity < m_position + p_size) {
+			capacity *= 2;
+		}
+
+		LegoU8* buffer = new LegoU8[capacity];
+		if (m_buffer) {
+			memcpy(buffer, m_buffer, m_size);
+			delete[] m_buffer;
+		}
+		m_buffer = buffer;
+		m_capacity = capacity;
+	}
+
+	memcpy(m_buffer + m_position, p_buffer, p_size);
+	m_position += p_size;
+	if (m_position > m_size) {
+		m_size = m_position;
+	}
+	return SUCCESS;
+}
+
 // FUNCTION: LEGO1 0x100991c0
 LegoFile::LegoFile()
 {
 	m_file = NULL;
+	m_buffer = NULL;
+	m_bufferPosition = 0;
+	m_bufferLength = 0;
+	m_bufferDirty = FALSE;
 }
 
 // FUNCTION: LEGO1 0x10099250
 LegoFile::~LegoFile()
 {
 	if (m_file) {
-		SDL_CloseIO(m_file);
+		Close();
 	}
+
+	delete[] m_buffer;
 }
 
 // FUNCTION: LEGO1 0x100992c0
@@ -55,9 +111,37 @@ LegoResult LegoFile::Read(void* p_buffer, LegoU32 p_size)
 	if (!m_file) {
 		return FAILURE;
 	}
-	if (SDL_ReadIO(m_file, p_buffer, p_size) != p_size) {
+	if (m_bufferDirty && Flush() != SUCCESS) {
 		return FAILURE;
 	}
+
+	LegoU8* buffer = (LegoU8*) p_buffer;
+
+	while (p_size > 0) {
+		if (m_bufferPosition == m_bufferLength) {
+			if (p_size >= c_bufferSize) {
+				if (SDL_ReadIO(m_file, buffer, p_size) != p_size) {
+					return FAILURE;
+				}
+				return SUCCESS;
+			}
+
+			if (FillBuffer() != SUCCESS) {
+				return FAILURE;
+			}
+		}
+
+		LegoU32 length = m_bufferLength - m_bufferPosition;
+		if (length > p_size) {
+			length = p_size;
+		}
+
+		memcpy(buffer, m_buffer + m_bufferPosition, length);
+		m_bufferPosition += length;
+		buffer += length;
+		p_size -= length;
+	}
+
 	return SUCCESS;
 }
 
@@ -67,9 +151,27 @@ LegoResult LegoFile::Write(const void* p_buffer, LegoU32 p_size)
 	if (!m_file) {
 		return FAILURE;
 	}
-	if (SDL_WriteIO(m_file, p_buffer, p_size) != p_size) {
+	if (!m_bufferDirty && DiscardReadBuffer() != SUCCESS) {
 		return FAILURE;
 	}
+	if (m_bufferLength + p_size > c_bufferSize && Flush() != SUCCESS) {
+		return FAILURE;
+	}
+
+	if (p_size >= c_bufferSize) {
+		if (SDL_WriteIO(m_file, p_buffer, p_size) != p_size) {
+			return FAILURE;
+		}
+		return SUCCESS;
+	}
+
+	if (m_buffer == NULL) {
+		m_buffer = new LegoU8[c_bufferSize];
+	}
+
+	memcpy(m_buffer + m_bufferLength, p_buffer, p_size);
+	m_bufferLength += p_size;
+	m_bufferDirty = TRUE;
 	return SUCCESS;
 }
 
@@ -83,6 +185,12 @@ LegoResult LegoFile::GetPosition(LegoU32& p_position)
 	if (position == -1) {
 		return FAILURE;
 	}
+	if (m_bufferDirty) {
+		position += m_bufferLength;
+	}
+	else {
+		position -= m_bufferLength - m_bufferPosition;
+	}
 	p_position = position;
 	return SUCCESS;
 }
@@ -93,18 +201,78 @@ LegoResult LegoFile::SetPosition(LegoU32 p_position)
 	if (!m_file) {
 		return FAILURE;
 	}
+	if (Flush() != SUCCESS) {
+		return FAILURE;
+	}
+	m_bufferPosition = m_bufferLength = 0;
 	if (SDL_SeekIO(m_file, p_position, SDL_IO_SEEK_SET) != p_position) {
 		return FAILURE;
 	}
 	return SUCCESS;
 }
 
+// Writes out any buffered writes
+LegoResult LegoFile::Flush()
+{
+	if (!m_bufferDirty) {
+		return SUCCESS;
+	}
+
+	LegoU32 length = m_bufferLength;
+	m_bufferPosition = m_bufferLength = 0;
+	m_bufferDirty = FALSE;
+
+	if (SDL_WriteIO(m_file, m_buffer, length) != length) {
+		return FAILURE;
+	}
+	return SUCCESS;
+}
+
+LegoResult LegoFile::FillBuffer()
+{
+	if (m_buffer == NULL) {
+		m_buffer = new LegoU8[c_bufferSize];
+	}
+
+	m_bufferPosition = 0;
+	m_bufferLength = SDL_ReadIO(m_file, m_buffer, c_bufferSize);
+
+	if (m_bufferLength == 0) {
+		return FAILURE;
+	}
+	return SUCCESS;
+}
+
+// Moves the file back to the first byte that was read ahead but not consumed
+LegoResult LegoFile::DiscardReadBuffer()
+{
+	LegoU32 unread = m_bufferLength - m_bufferPosition;
+	m_bufferPosition = m_bufferLength = 0;
+
+	if (unread != 0 && SDL_SeekIO(m_file, -(Sint64) unread, SDL_IO_SEEK_CUR) == -1) {
+		return FAILURE;
+	}
+	return SUCCESS;
+}
+
+// Writes out any buffered writes and closes the file. Nothing is left to report a failed
+// write to at this point, so it is logged.
+void LegoFile::Close()
+{
+	LegoBool written = Flush() == SUCCESS;
+
+	if ((!SDL_CloseIO(m_file) || !written) && IsWriteMode()) {
+		SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to write file: %s", SDL_GetError());
+	}
+}
+
 // FUNCTION: LEGO1 0x100993a0
 LegoResult LegoFile::Open(const char* p_name, LegoU32 p_mode)
 {
 	if (m_file) {
-		SDL_CloseIO(m_file);
+		Close();
 	}
+	m_bufferPosition = m_bufferLength = 0;
 	char mode[4];
 	mode[0] = '\0';
 	if (p_mode & c_read) {
@@ -167,6 +167,25 @@ class LegoStorage {
 		return this;
 	}
 
+	LegoResult ReadFloats(LegoFloat* p_data, LegoU32 p_count) { return Read(p_data, p_count * sizeof(LegoFloat)); }
+	LegoResult ReadU16s(LegoU16* p_data, LegoU32 p_count) { return Read(p_data, p_count * sizeof(LegoU16)); }
+	LegoResult ReadU32s(LegoU32* p_data, LegoU32 p_count) { return Read(p_data, p_count * sizeof(LegoU32)); }
+
+	// Reads a string prefixed with its LegoU8 length into a new[] buffer owned by the caller.
+	// p_data is allocated before the characters are read, as the parsers using it expect.
+	LegoResult ReadU8String(char*& p_data)
+	{
+		LegoU8 length;
+
+		if (Read(&length, sizeof(length)) != SUCCESS) {
+			return FAILURE;
+		}
+
+		p_data = new char[length + 1];
+		p_data[length] = '\0';
+		return Read(p_data, length);
+	}
+
 	// FUNCTION: LEGO1 0x10034470
 	LegoStorage* ReadMxString(MxString& p_data)
 	{
@@ -224,6 +243,41 @@ class LegoMemory : public LegoStorage {
 	LegoU32 m_size;
 };
 
+// Write-mode memory storage that grows as data is written to it.
+// Used to build a file in memory before writing it out in one piece.
+class LegoGrowableMemory : public LegoStorage {
+public:
+	LegoGrowableMemory();
+	~LegoGrowableMemory() override;
+
+	LegoResult Read(void* p_buffer, LegoU32 p_size) override;
+	LegoResult Write(const void* p_buffer, LegoU32 p_size) override;
+
+	LegoResult GetPosition(LegoU32& p_position) override
+	{
+		p_position = m_position;
+		return SUCCESS;
+	}
+
+	LegoResult SetPosition(LegoU32 p_position) override
+	{
+		if (p_position > m_size) {
+			return FAILURE;
+		}
+		m_position = p_position;
+		return SUCCESS;
+	}
+
+	const LegoU8* GetData() const { return m_buffer; }
+	LegoU32 GetSize() const { return m_size; }
+
+protected:
+	LegoU8* m_buffer;
+	LegoU32 m_position;
+	LegoU32 m_size;
+	LegoU32 m_capacity;
+};
+
 // VTABLE: LEGO1 0x100db730
 // SIZE 0x0c
 class LegoFile : public LegoStorage {
@@ -236,12 +290,28 @@ class LegoFile : public LegoStorage {
 	LegoResult GetPosition(LegoU32& p_position) override;            // vtable+0x0c
 	LegoResult SetPosition(LegoU32 p_position) override;             // vtable+0x10
 	LegoResult Open(const char* p_name, LegoU32 p_mode);
+	LegoResult Flush();
 
 	// SYNTHETIC: LEGO1 0x10099230
 	// LegoFile::`scalar deleting destructor'
 
 protected:
+	enum {
+		c_bufferSize = 0x8000
+	};
+
+	LegoResult FillBuffer();
+	LegoResult DiscardReadBuffer();
+	void Close();
+
 	SDL_IOStream* m_file; // 0x08
+
+	// Reads are served from m_buffer[m_bufferPosition, m_bufferLength) after reading ahead from
+	// m_file. Writes are collected in m_buffer[0, m_bufferLength) and written out by Flush.
+	LegoU8* m_buffer;
+	LegoU32 m_bufferPosition;
+	LegoU32 m_bufferLength;
+	LegoBool m_bufferDirty;
 };
 
 #endif // __LEGOSTORAGE_H
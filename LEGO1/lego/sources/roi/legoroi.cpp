@@ -349,8 +349,7 @@ LegoResult LegoROI::Read(
 // FUNCTION: BETA10 0x1018a7e8
 LegoResult LegoROI::CreateLocalTransform(LegoAnimNodeData* p_data, LegoTime p_time, Matrix4& p_matrix)
 {
-	p_matrix.SetIdentity();
-	p_data->CreateLocalTransform(p_time, p_matrix);
+	p_data->SampleLocalTransform(p_time, p_matrix);
 	return SUCCESS;
 }
 
@@ -436,9 +435,15 @@ void LegoROI::ApplyAnimationTransformation(LegoTreeNode* p_node, Matrix4& p_matr
 	MxMatrix mat;
 
 	LegoAnimNodeData* data = (LegoAnimNodeData*) p_node->GetData();
+	LegoROI* roi = p_roiMap[data->GetROIIndex()];
+
+	if (roi == NULL && p_node->GetNumChildren() == 0) {
+		// Nothing would consume the transform of a leaf without an ROI
+		return;
+	}
+
 	CreateLocalTransform(data, p_time, mat);
 
-	LegoROI* roi = p_roiMap[data->GetROIIndex()];
 	if (roi != NULL) {
 		roi->m_local2world.Product(mat, p_matrix);
 		roi->UpdateWorldData();
@@ -467,9 +472,14 @@ void LegoROI::ApplyTransform(LegoTreeNode* p_node, Matrix4& p_matrix, LegoTime p
 	MxMatrix mat;
 
 	LegoAnimNodeData* data = (LegoAnimNodeData*) p_node->GetData();
+	LegoROI* roi = p_roiMap[data->GetROIIndex()];
+
+	if (roi == NULL && p_node->GetNumChildren() == 0) {
+		return;
+	}
+
 	CreateLocalTransform(data, p_time, mat);
 
-	LegoROI* roi = p_roiMap[data->GetROIIndex()];
 	if (roi != NULL) {
 		roi->m_local2world.Product(mat, p_matrix);
 
@@ -611,6 +621,56 @@ LegoResult LegoROI::FUN_100a93b0(const LegoChar* p_name)
 	return 0;
 }
 
+// Conservative broad phase for the box test in FUN_100a9410. When the rows of p_local2world are
+// orthonormal, every point the slab tests can accept lies inside the sphere circumscribing the
+// world box, so a segment that stays outside that sphere cannot register a hit.
+static LegoBool SegmentMissesBox(
+	const Matrix4& p_local2world,
+	const BoundingBox& p_box,
+	const Vector3& p_v1,
+	const Vector3& p_v2,
+	float p_f1
+)
+{
+	const float epsilon = 0.001f;
+
+	for (LegoS32 i = 0; i < 3; i++) {
+		if (SDL_fabsf(NORMSQRD3(p_local2world[i]) - 1.0f) > epsilon) {
+			return FALSE;
+		}
+
+		for (LegoS32 j = i + 1; j < 3; j++) {
+			if (SDL_fabsf(DOT3(p_local2world[i], p_local2world[j])) > epsilon) {
+				return FALSE;
+			}
+		}
+	}
+
+	float localCenter[3], center[3];
+	VPV3(localCenter, p_box.Min(), p_box.Max());
+	VXS3(localCenter, localCenter, 0.5f);
+	VXM3(center, localCenter, p_local2world);
+	VPV3(center, center, p_local2world[3]);
+
+	float radius = SDL_sqrtf(DISTSQRD3(p_box.Min(), p_box.Max())) * 0.5f;
+	radius += radius * epsilon + 0.01f;
+
+	float toCenter[3];
+	VMV3(toCenter, center, p_v1);
+
+	float t = 0.0f;
+	float lenSquared = NORMSQRD3(p_v2);
+	if (lenSquared > 0.0f) {
+		t = DOT3(toCenter, p_v2) / lenSquared;
+		t = SDL_clamp(t, 0.0f, p_f1);
+	}
+
+	float closest[3];
+	VPSXV3(closest, p_v1, t, p_v2);
+
+	return DISTSQRD3(closest, center) > radius * radius;
+}
+
 // FUNCTION: LEGO1 0x100a9410
 // FUNCTION: BETA10 0x1018b324
 LegoU32 LegoROI::FUN_100a9410(
@@ -623,6 +683,11 @@ LegoU32 LegoROI::FUN_100a9410(
 )
 {
 	if (p_collideBox) {
+		if (SegmentMissesBox(m_local2world, m_bounding_box, p_v1, p_v2, p_f1)) {
+			p_v3 = m_local2world[3];
+			return 0;
+		}
+
 		Mx3DPointFloat v2(p_v2);
 		v2 *= p_f1;
 		v2 += p_v1;
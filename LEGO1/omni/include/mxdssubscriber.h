@@ -6,6 +6,8 @@
 #include "mxstreamchunklist.h"
 #include "mxutilitylist.h"
 
+#include <unordered_map>
+
 class MxDSObject;
 class MxDSSubscriber;
 class MxStreamController;
@@ -14,6 +16,20 @@ class MxStreamController;
 class MxDSSubscriberList : public MxUtilityList<MxDSSubscriber*> {
 public:
 	MxDSSubscriber* Find(MxDSObject* p_object);
+
+	// Chunk routing. Keeps an index from (object id, unk0x48) to the first matching
+	// subscriber in list order, so delivering a chunk doesn't walk the whole list.
+	void AddSubscriber(MxDSSubscriber* p_subscriber);
+	void RemoveSubscriber(MxDSSubscriber* p_subscriber);
+	MxDSSubscriber* FindRoute(MxU32 p_objectId, MxS16 p_unk0x48);
+
+private:
+	static MxU64 RouteKey(MxU32 p_objectId, MxS16 p_unk0x48)
+	{
+		return ((MxU64) p_objectId << 16) | (MxU16) p_unk0x48;
+	}
+
+	std::unordered_map<MxU64, MxDSSubscriber*> m_routes;
 };
 
 // VTABLE: LEGO1 0x100dc698
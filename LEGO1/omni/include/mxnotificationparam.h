@@ -31,7 +31,8 @@ enum NotificationId {
 	c_notificationNewPresenter = 21,
 	c_notificationAct2Brick = 22,
 	c_notificationType23 = 23,
-	c_notificationTransitioned = 24
+	c_notificationTransitioned = 24,
+	c_notificationSaveComplete = 25
 };
 
 // VTABLE: LEGO1 0x100d56e0
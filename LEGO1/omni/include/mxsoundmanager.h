@@ -5,7 +5,9 @@
 #include "mxatom.h"
 #include "mxaudiomanager.h"
 #include "mxminiaudio.h"
+#include "mxthread.h"
 
+#include <SDL3/SDL_atomic.h>
 #include <SDL3/SDL_audio.h>
 
 // VTABLE: LEGO1 0x100dc128
@@ -26,6 +28,9 @@ class MxSoundManager : public MxAudioManager {
 
 	float GetAttenuation(MxU32 p_volume);
 
+	// [library:audio] Number of device callbacks the mixer could not fully serve
+	MxS32 GetUnderrunCount() { return SDL_GetAtomicInt(&m_underrunCount); }
+
 	MxPresenter* FindPresenter(const MxAtomId& p_atomId, MxU32 p_objectId);
 
 	// SYNTHETIC: LEGO1 0x100ae7b0
@@ -33,14 +38,37 @@ class MxSoundManager : public MxAudioManager {
 	// MxSoundManager::`scalar deleting destructor'
 
 protected:
+	// [library:audio]
+	// Mixes the engine output ahead of the audio device on a dedicated thread.
+	// The device callback only copies already mixed frames out of `m_mixBuffer`.
+	class MixThread : public MxThread {
+	public:
+		MixThread(MxSoundManager* p_manager) { m_manager = p_manager; }
+
+		MxResult Run() override;
+
+	private:
+		MxSoundManager* m_manager;
+	};
+
 	void Init();
 	void Destroy(MxBool p_fromDestructor);
+	void Mix();
 
 	// [library:audio]
 	// Upscaling everything to 44.1KHz, since we have various sample rates throughout the game.
 	// Not sure how DirectSound handles this when different buffers have different rates.
 	static const MxU32 g_sampleRate = 44100;
 
+	// [library:audio] Upper bound for the amount of audio mixed ahead of the device
+	static const MxU32 g_mixBufferSizeInMilliseconds = 250;
+
+	// [library:audio] Initial mix-ahead until the device has reported its request size
+	static const MxU32 g_mixLatencyInMilliseconds = 20;
+
+	// [library:audio] Polling interval of the mix thread
+	static const MxS32 g_mixIntervalMS = 2;
+
 	static void AudioStreamCallback(
 		void* p_userdata,
 		SDL_AudioStream* p_stream,
@@ -50,6 +78,15 @@ class MxSoundManager : public MxAudioManager {
 
 	MxMiniaudio<ma_engine> m_engine;
 	SDL_AudioStream* m_stream;
+
+	// [library:audio]
+	// Single-producer (mix thread), single-consumer (device callback) ring of mixed frames.
+	// `m_mixLatency` is the number of frames the mix thread keeps queued; it grows with the
+	// largest request observed from the device.
+	MxMiniaudio<ma_pcm_rb> m_mixBuffer;
+	MixThread* m_mixThread;
+	SDL_AtomicInt m_mixLatency;
+	SDL_AtomicInt m_underrunCount;
 	undefined m_unk0x38[4];
 };
 
@@ -11,9 +11,23 @@
 #include "mxtypes.h"
 
 #include <assert.h>
+#include <string_view>
+#include <unordered_map>
 
 class MxDSObject;
 
+struct MxStreamControllerNameHash {
+	size_t operator()(const char* p_name) const { return std::hash<std::string_view>()(p_name); }
+};
+
+struct MxStreamControllerNameEqual {
+	bool operator()(const char* p_a, const char* p_b) const { return p_a == p_b || !strcmp(p_a, p_b); }
+};
+
+// Open controllers by atom name. Keys point into the controllers' own atoms.
+typedef std::unordered_map<const char*, MxStreamController*, MxStreamControllerNameHash, MxStreamControllerNameEqual>
+	MxStreamControllerMap;
+
 typedef MxMemoryPool<64, 22> MxMemoryPool64;
 typedef MxMemoryPool<128, 2> MxMemoryPool128;
 
@@ -120,6 +134,9 @@ class MxStreamer : public MxCore {
 	list<MxStreamController*> m_controllers; // 0x08
 	MxMemoryPool64 m_pool64;                 // 0x14
 	MxMemoryPool128 m_pool128;               // 0x20
+
+	// Mirrors `m_controllers` for GetOpenStream, which runs for every started action
+	MxStreamControllerMap m_controllerMap;
 };
 
 // clang-format off
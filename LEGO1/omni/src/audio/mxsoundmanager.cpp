@@ -44,6 +44,10 @@ void MxSoundManager::Init()
 {
 	SDL_zero(m_engine);
 	m_stream = NULL;
+	SDL_zero(m_mixBuffer);
+	m_mixThread = NULL;
+	SDL_SetAtomicInt(&m_mixLatency, 0);
+	SDL_SetAtomicInt(&m_underrunCount, 0);
 }
 
 // FUNCTION: LEGO1 0x100ae840
@@ -64,6 +68,12 @@ void MxSoundManager::Destroy(MxBool p_fromDestructor)
 		SDL_DestroyAudioStream(m_stream);
 	}
 
+	if (m_mixThread) {
+		m_mixThread->Terminate();
+		delete m_mixThread;
+	}
+
+	m_mixBuffer.Destroy(ma_pcm_rb_uninit);
 	m_engine.Destroy(ma_engine_uninit);
 
 	Init();
@@ -98,6 +108,27 @@ MxResult MxSoundManager::Create(MxU32 p_frequencyMS, MxBool p_createThread)
 		goto done;
 	}
 
+	if (m_mixBuffer.Init(
+			ma_pcm_rb_init,
+			ma_format_f32,
+			ma_engine_get_channels(m_engine),
+			ma_calculate_buffer_size_in_frames_from_milliseconds(g_mixBufferSizeInMilliseconds, g_sampleRate),
+			nullptr,
+			nullptr
+		) != MA_SUCCESS) {
+		goto done;
+	}
+
+	SDL_SetAtomicInt(
+		&m_mixLatency,
+		ma_calculate_buffer_size_in_frames_from_milliseconds(g_mixLatencyInMilliseconds, g_sampleRate)
+	);
+
+	m_mixThread = new MixThread(this);
+	if (!m_mixThread || m_mixThread->Start(0, 0) != SUCCESS) {
+		goto done;
+	}
+
 	SDL_AudioSpec spec;
 	SDL_zero(spec);
 	spec.freq = ma_engine_get_sample_rate(m_engine);
@@ -147,19 +178,72 @@ void MxSoundManager::AudioStreamCallback(
 	int p_totalAmount
 )
 {
-	static vector<MxU8> g_buffer;
-	g_buffer.reserve(p_additionalAmount);
-
 	MxSoundManager* manager = (MxSoundManager*) p_userdata;
-	ma_uint32 bytesPerFrame = ma_get_bytes_per_frame(ma_format_f32, ma_engine_get_channels(manager->m_engine));
-	ma_uint32 bufferSizeInFrames = (ma_uint32) p_additionalAmount / bytesPerFrame;
-	ma_uint64 framesRead;
+	ma_pcm_rb* rb = manager->m_mixBuffer;
+	ma_uint32 bytesPerFrame = ma_get_bytes_per_frame(rb->format, rb->channels);
+	ma_uint32 requestedFrames = (ma_uint32) p_additionalAmount / bytesPerFrame;
+
+	// [library:audio] Keep twice the largest device request mixed ahead, bounded by the ring size.
+	MxS32 latency = (MxS32) SDL_min(requestedFrames * 2, ma_pcm_rb_get_subbuffer_size(rb));
+	if (latency > SDL_GetAtomicInt(&manager->m_mixLatency)) {
+		SDL_SetAtomicInt(&manager->m_mixLatency, latency);
+	}
+
+	while (requestedFrames > 0) {
+		ma_uint32 frames = requestedFrames;
+		void* bufferIn;
+
+		if (ma_pcm_rb_acquire_read(rb, &frames, &bufferIn) != MA_SUCCESS || frames == 0) {
+			break;
+		}
+
+		SDL_PutAudioStreamData(p_stream, bufferIn, frames * bytesPerFrame);
+		ma_pcm_rb_commit_read(rb, frames);
+		requestedFrames -= frames;
+	}
 
-	if (ma_engine_read_pcm_frames(manager->m_engine, g_buffer.data(), bufferSizeInFrames, &framesRead) == MA_SUCCESS) {
-		SDL_PutAudioStreamData(manager->m_stream, g_buffer.data(), framesRead * bytesPerFrame);
+	// [library:audio] SDL pads the missing frames with silence.
+	if (requestedFrames > 0) {
+		SDL_AddAtomicInt(&manager->m_underrunCount, 1);
 	}
 }
 
+void MxSoundManager::Mix()
+{
+	ma_pcm_rb* rb = m_mixBuffer;
+	ma_uint32 available = ma_pcm_rb_available_read(rb);
+	ma_uint32 latency = SDL_GetAtomicInt(&m_mixLatency);
+
+	while (available < latency) {
+		ma_uint32 frames = latency - available;
+		ma_uint64 framesRead = 0;
+		void* bufferOut;
+
+		if (ma_pcm_rb_acquire_write(rb, &frames, &bufferOut) != MA_SUCCESS || frames == 0) {
+			break;
+		}
+
+		ma_engine_read_pcm_frames(m_engine, bufferOut, frames, &framesRead);
+		ma_pcm_rb_commit_write(rb, (ma_uint32) framesRead);
+
+		if (framesRead == 0) {
+			break;
+		}
+
+		available += (ma_uint32) framesRead;
+	}
+}
+
+MxResult MxSoundManager::MixThread::Run()
+{
+	while (IsRunning()) {
+		m_manager->Mix();
+		Sleep(g_mixIntervalMS);
+	}
+
+	return MxThread::Run();
+}
+
 // FUNCTION: LEGO1 0x100aeab0
 // FUNCTION: BETA10 0x101331e3
 void MxSoundManager::Destroy()
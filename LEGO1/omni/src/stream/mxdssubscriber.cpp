@@ -151,3 +151,38 @@ MxDSSubscriber* MxDSSubscriberList::Find(MxDSObject* p_object)
 
 	return NULL;
 }
+
+void MxDSSubscriberList::AddSubscriber(MxDSSubscriber* p_subscriber)
+{
+	PushBack(p_subscriber);
+
+	// Only the first subscriber for a key receives chunks, same as the list walk
+	MxU64 key = RouteKey(p_subscriber->GetObjectId(), p_subscriber->GetUnknown48());
+	m_routes.insert(std::make_pair(key, p_subscriber));
+}
+
+void MxDSSubscriberList::RemoveSubscriber(MxDSSubscriber* p_subscriber)
+{
+	remove(p_subscriber);
+
+	MxU64 key = RouteKey(p_subscriber->GetObjectId(), p_subscriber->GetUnknown48());
+	std::unordered_map<MxU64, MxDSSubscriber*>::iterator route = m_routes.find(key);
+
+	if (route != m_routes.end() && route->second == p_subscriber) {
+		m_routes.erase(route);
+
+		for (iterator it = begin(); it != end(); it++) {
+			if ((*it)->GetObjectId() == p_subscriber->GetObjectId() &&
+				(*it)->GetUnknown48() == p_subscriber->GetUnknown48()) {
+				m_routes[key] = *it;
+				break;
+			}
+		}
+	}
+}
+
+MxDSSubscriber* MxDSSubscriberList::FindRoute(MxU32 p_objectId, MxS16 p_unk0x48)
+{
+	std::unordered_map<MxU64, MxDSSubscriber*>::iterator route = m_routes.find(RouteKey(p_objectId, p_unk0x48));
+	return route != m_routes.end() ? route->second : NULL;
+}
@@ -60,17 +60,18 @@ MxU32 MxStreamChunk::ReadChunkHeader(MxU8* p_chunkData)
 // FUNCTION: BETA10 0x10151517
 MxResult MxStreamChunk::SendChunk(MxDSSubscriberList& p_subscriberList, MxBool p_append, MxS16 p_obj24val)
 {
-	for (MxDSSubscriberList::iterator it = p_subscriberList.begin(); it != p_subscriberList.end(); it++) {
-		if ((*it)->GetObjectId() == m_objectId && (*it)->GetUnknown48() == p_obj24val) {
-			if (m_flags & DS_CHUNK_END_OF_STREAM && m_buffer) {
-				m_buffer->ReleaseRef(this);
-				m_buffer = NULL;
-			}
-
-			(*it)->AddData(this, p_append);
+	// Hashed lookup instead of a linear walk over all subscribers
+	MxDSSubscriber* subscriber = p_subscriberList.FindRoute(m_objectId, p_obj24val);
 
-			return SUCCESS;
+	if (subscriber) {
+		if (m_flags & DS_CHUNK_END_OF_STREAM && m_buffer) {
+			m_buffer->ReleaseRef(this);
+			m_buffer = NULL;
 		}
+
+		subscriber->AddData(this, p_append);
+
+		return SUCCESS;
 	}
 
 	return FAILURE;
@@ -80,14 +80,14 @@ MxResult MxStreamController::Open(const char* p_filename)
 // FUNCTION: BETA10 0x1014e730
 void MxStreamController::AddSubscriber(MxDSSubscriber* p_subscriber)
 {
-	m_subscribers.PushBack(p_subscriber);
+	m_subscribers.AddSubscriber(p_subscriber);
 }
 
 // FUNCTION: LEGO1 0x100c1620
 // FUNCTION: BETA10 0x1014e7b4
 void MxStreamController::RemoveSubscriber(MxDSSubscriber* p_subscriber)
 {
-	m_subscribers.remove(p_subscriber);
+	m_subscribers.RemoveSubscriber(p_subscriber);
 }
 
 // FUNCTION: LEGO1 0x100c1690
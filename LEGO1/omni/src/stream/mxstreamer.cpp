@@ -51,6 +51,7 @@ MxStreamer::~MxStreamer()
 #endif
 
 		m_controllers.pop_front();
+		m_controllerMap.erase(controller->GetAtom().GetInternal());
 		delete controller;
 	}
 
@@ -105,6 +106,7 @@ MxLong MxStreamer::Close(const char* p_name)
 
 		if (!p_name || c->GetAtom() == p_name) {
 			m_controllers.erase(it);
+			m_controllerMap.erase(c->GetAtom().GetInternal());
 
 			if (c->IsStoped(&ds)) {
 				delete c;
@@ -131,10 +133,13 @@ MxNotificationParam* MxStreamerNotification::Clone() const
 // FUNCTION: BETA10 0x1014584b
 MxStreamController* MxStreamer::GetOpenStream(const char* p_name)
 {
-	for (list<MxStreamController*>::iterator it = m_controllers.begin(); it != m_controllers.end(); it++) {
-		if ((*it)->GetAtom() == p_name) {
-			return *it;
-		}
+	if (p_name == NULL) {
+		return NULL;
+	}
+
+	MxStreamControllerMap::iterator it = m_controllerMap.find(p_name);
+	if (it != m_controllerMap.end()) {
+		return it->second;
 	}
 
 	return NULL;
@@ -160,6 +165,7 @@ MxResult MxStreamer::AddStreamControllerToOpenList(MxStreamController* p_stream)
 	// DECOMP: Retail is missing the optimization that skips this check if find() reaches the end.
 	if (i == m_controllers.end()) {
 		m_controllers.push_back(p_stream);
+		m_controllerMap[p_stream->GetAtom().GetInternal()] = p_stream;
 		return SUCCESS;
 	}
 
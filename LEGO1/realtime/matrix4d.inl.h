@@ -6,6 +6,10 @@
 #include <math.h>
 #include <memory.h>
 
+#if defined(__x86_64__) || defined(_M_X64)
+#include <xmmintrin.h>
+#endif
+
 // FUNCTION: LEGO1 0x10002320
 // FUNCTION: BETA10 0x1000fcb0
 void Matrix4::CopyFrom(float (*p_data)[4])
@@ -120,6 +124,18 @@ void Matrix4::SetTranslation(const float& p_x, const float& p_y, const float& p_
 // FUNCTION: BETA10 0x100100a0
 void Matrix4::Product(float (*p_a)[4], float (*p_b)[4])
 {
+#if defined(__x86_64__) || defined(_M_X64)
+	// Each row of the result is a sum of the rows of p_b scaled by that row of p_a. The terms are
+	// added in the same order as in the scalar loop below, so both produce identical results.
+	for (int row = 0; row < 4; row++) {
+		__m128 sum = _mm_setzero_ps();
+		sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(p_a[row][0]), _mm_loadu_ps(p_b[0])));
+		sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(p_a[row][1]), _mm_loadu_ps(p_b[1])));
+		sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(p_a[row][2]), _mm_loadu_ps(p_b[2])));
+		sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(p_a[row][3]), _mm_loadu_ps(p_b[3])));
+		_mm_storeu_ps(m_data[row], sum);
+	}
+#else
 	float* cur = (float*) m_data;
 
 	for (int row = 0; row < 4; row++) {
@@ -131,6 +147,7 @@ void Matrix4::Product(float (*p_a)[4], float (*p_b)[4])
 			cur++;
 		}
 	}
+#endif
 }
 
 // FUNCTION: LEGO1 0x10002530
@@ -6,6 +6,7 @@
 #include "mxatom.h"
 
 #include <map>
+#include <unordered_map>
 #include <vector>
 
 namespace si
@@ -21,10 +22,10 @@ class SiLoader {
 
 	static void Initialize();
 	static bool Load();
-	static std::optional<MxCore*> HandleFind(StreamObject p_object, LegoWorld* world);
+	static std::optional<MxCore*> HandleFind(const StreamObject& p_object, LegoWorld* world);
 	static std::optional<MxResult> HandleStart(MxDSAction& p_action);
 	static MxBool HandleWorld(LegoWorld* p_world);
-	static std::optional<MxBool> HandleRemove(StreamObject p_object, LegoWorld* world);
+	static std::optional<MxBool> HandleRemove(const StreamObject& p_object, LegoWorld* world);
 	static std::optional<MxBool> HandleDelete(MxDSAction& p_action);
 	static MxBool HandleEndAction(MxEndActionNotificationParam& p_param);
 
@@ -37,12 +38,42 @@ class SiLoader {
 	static bool enabled;
 
 private:
-	static std::vector<std::pair<StreamObject, StreamObject>> startWith;
-	static std::vector<std::pair<StreamObject, StreamObject>> removeWith;
-	static std::vector<std::pair<StreamObject, StreamObject>> replace;
-	static std::vector<std::pair<StreamObject, StreamObject>> prepend;
-	static std::vector<StreamObject> fullScreenMovie;
-	static std::vector<StreamObject> disable3d;
+	typedef std::pair<StreamObject, StreamObject> Directive;
+
+	// Atoms are interned, so objects are keyed on the atom's internal string pointer. This avoids
+	// copying an MxAtomId (and looking it up in the atom set) for every action that is checked.
+	typedef std::pair<const char*, MxU32> DirectiveKey;
+
+	struct DirectiveKeyHash {
+		size_t operator()(const DirectiveKey& p_key) const
+		{
+			return std::hash<const char*>()(p_key.first) ^ (std::hash<MxU32>()(p_key.second) * 31);
+		}
+	};
+
+	// Directives matching a key, in the order they were loaded
+	typedef std::unordered_map<DirectiveKey, std::vector<Directive>, DirectiveKeyHash> DirectiveMap;
+	typedef std::unordered_map<DirectiveKey, StreamObject, DirectiveKeyHash> ObjectMap;
+
+	static DirectiveMap startWith;
+	static DirectiveMap removeWith;
+	static DirectiveMap replace;
+	static DirectiveMap replacedBy; // replace keyed on the replacement
+	static DirectiveMap prepend;
+	static DirectiveMap prependedTo; // prepend keyed on the prepended object
+	static ObjectMap fullScreenMovie;
+	static ObjectMap disable3d;
+
+	static DirectiveKey Key(const MxAtomId& p_atomId, MxU32 p_id) { return {p_atomId.GetInternal(), p_id}; }
+	static DirectiveKey Key(const StreamObject& p_object) { return Key(p_object.first, p_object.second); }
+	static const std::vector<Directive>& Find(const DirectiveMap& p_map, const DirectiveKey& p_key);
+	static void AddDirective(
+		DirectiveMap& p_map,
+		DirectiveMap* p_reverseMap,
+		const StreamObject& p_origin,
+		const StreamObject& p_target
+	);
+	static void AddObject(ObjectMap& p_map, const StreamObject& p_object);
 
 	static bool LoadFile(const char* p_file);
 	static bool LoadDirective(const char* p_directive);
@@ -55,10 +86,10 @@ class SiLoader {
 template <typename... Args>
 std::optional<SiLoader::StreamObject> SiLoader::ReplacedIn(MxDSAction& p_action, Args... p_args)
 {
-	StreamObject object{p_action.GetAtomId(), p_action.GetObjectId()};
-	auto checkAtomId = [&p_action, &object](const auto& p_atomId) -> std::optional<StreamObject> {
-		for (const auto& key : replace) {
-			if (key.second == object && key.first.first == p_atomId) {
+	const std::vector<Directive>& directives = Find(replacedBy, Key(p_action.GetAtomId(), p_action.GetObjectId()));
+	auto checkAtomId = [&directives](const auto& p_atomId) -> std::optional<StreamObject> {
+		for (const auto& key : directives) {
+			if (key.first.first == p_atomId) {
 				return key.first;
 			}
 		}
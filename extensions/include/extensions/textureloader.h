@@ -4,7 +4,10 @@
 #include "legotextureinfo.h"
 
 #include <array>
+#include <list>
 #include <map>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace Extensions
@@ -18,12 +21,28 @@ class TextureLoader {
 	static std::vector<std::string> excludedFiles;
 	static bool enabled;
 
-	static constexpr std::array<std::pair<std::string_view, std::string_view>, 1> defaults = {
-		{{"texture loader:texture path", "/textures"}}
+	static constexpr std::array<std::pair<std::string_view, std::string_view>, 2> defaults = {
+		{{"texture loader:texture path", "/textures"}, {"texture loader:cache size", "8"}}
 	};
 
 private:
-	static SDL_Surface* FindTexture(const char* p_name);
+	typedef std::list<std::pair<std::string, SDL_Surface*>> SurfaceCache;
+
+	static SDL_Surface* FindTexture(const char* p_name, bool& p_owned);
+	static bool CopyTexture(LegoTextureInfo* p_textureInfo, SDL_Surface* p_surface);
+	static void IndexTextures();
+	static void IndexDirectory(const char* p_base);
+
+	// Lower case texture name to the path of its override, built on first use
+	static std::unordered_map<std::string, std::string> textureFiles;
+	static bool indexed;
+
+	// Recently decoded overrides, most recently used first. Limited to cacheLimit bytes of
+	// pixel data ("texture loader:cache size", in megabytes); 0 disables the cache.
+	static SurfaceCache cache;
+	static std::unordered_map<std::string, SurfaceCache::iterator> cacheIndex;
+	static size_t cacheBytes;
+	static size_t cacheLimit;
 };
 
 #ifdef EXTENSIONS
@@ -14,12 +14,14 @@ const char prependedMarker[] = ";;prepended;;";
 std::map<std::string, std::string> SiLoader::options;
 std::vector<std::string> SiLoader::files;
 std::vector<std::string> SiLoader::directives;
-std::vector<std::pair<SiLoader::StreamObject, SiLoader::StreamObject>> SiLoader::startWith;
-std::vector<std::pair<SiLoader::StreamObject, SiLoader::StreamObject>> SiLoader::removeWith;
-std::vector<std::pair<SiLoader::StreamObject, SiLoader::StreamObject>> SiLoader::replace;
-std::vector<std::pair<SiLoader::StreamObject, SiLoader::StreamObject>> SiLoader::prepend;
-std::vector<SiLoader::StreamObject> SiLoader::fullScreenMovie;
-std::vector<SiLoader::StreamObject> SiLoader::disable3d;
+SiLoader::DirectiveMap SiLoader::startWith;
+SiLoader::DirectiveMap SiLoader::removeWith;
+SiLoader::DirectiveMap SiLoader::replace;
+SiLoader::DirectiveMap SiLoader::replacedBy;
+SiLoader::DirectiveMap SiLoader::prepend;
+SiLoader::DirectiveMap SiLoader::prependedTo;
+SiLoader::ObjectMap SiLoader::fullScreenMovie;
+SiLoader::ObjectMap SiLoader::disable3d;
 bool SiLoader::enabled = false;
 
 void SiLoader::Initialize()
@@ -55,12 +57,12 @@ bool SiLoader::Load()
 	return true;
 }
 
-std::optional<MxCore*> SiLoader::HandleFind(StreamObject p_object, LegoWorld* world)
+std::optional<MxCore*> SiLoader::HandleFind(const StreamObject& p_object, LegoWorld* world)
 {
-	for (const auto& key : replace) {
-		if (key.first == p_object) {
-			return world->Find(key.second.first, key.second.second);
-		}
+	const std::vector<Directive>& replaced = Find(replace, Key(p_object));
+	if (!replaced.empty()) {
+		const StreamObject& key = replaced.front().second;
+		return world->Find(key.first, key.second);
 	}
 
 	return std::nullopt;
@@ -68,7 +70,7 @@ std::optional<MxCore*> SiLoader::HandleFind(StreamObject p_object, LegoWorld* wo
 
 std::optional<MxResult> SiLoader::HandleStart(MxDSAction& p_action)
 {
-	StreamObject object{p_action.GetAtomId(), p_action.GetObjectId()};
+	DirectiveKey object = Key(p_action.GetAtomId(), p_action.GetObjectId());
 	auto start = [](const StreamObject& p_object, MxDSAction& p_in, MxDSAction& p_out) -> MxResult {
 		if (!OpenStream(p_object.first.GetInternal())) {
 			return FAILURE;
@@ -82,46 +84,44 @@ std::optional<MxResult> SiLoader::HandleStart(MxDSAction& p_action)
 		return Start(&p_out);
 	};
 
-	for (const auto& key : startWith) {
-		if (key.first == object && !IsWorld(key.first)) {
+	for (const auto& key : Find(startWith, object)) {
+		if (!IsWorld(key.first)) {
 			MxDSAction action;
 			start(key.second, p_action, action);
 		}
 	}
 
-	for (const auto& key : replace) {
-		if (key.first == object) {
-			MxDSAction action;
-			MxResult result = start(key.second, p_action, action);
-
-			if (result == SUCCESS) {
-				p_action.SetUnknown24(action.GetUnknown24());
-			}
+	const std::vector<Directive>& replaced = Find(replace, object);
+	if (!replaced.empty()) {
+		MxDSAction action;
+		MxResult result = start(replaced.front().second, p_action, action);
 
-			return result;
+		if (result == SUCCESS) {
+			p_action.SetUnknown24(action.GetUnknown24());
 		}
+
+		return result;
 	}
 
 	if (p_action.GetExtraLength() == 0 || !SDL_strstr(p_action.GetExtraData(), prependedMarker)) {
-		for (const auto& key : prepend) {
-			if (key.first == object) {
-				MxDSAction action;
-				MxResult result = start(key.second, p_action, action);
-
-				if (result == SUCCESS) {
-					p_action.SetUnknown24(action.GetUnknown24());
-				}
+		const std::vector<Directive>& prepended = Find(prepend, object);
+		if (!prepended.empty()) {
+			MxDSAction action;
+			MxResult result = start(prepended.front().second, p_action, action);
 
-				return result;
+			if (result == SUCCESS) {
+				p_action.SetUnknown24(action.GetUnknown24());
 			}
+
+			return result;
 		}
 	}
 
-	if (std::find(fullScreenMovie.begin(), fullScreenMovie.end(), object) != fullScreenMovie.end()) {
+	if (fullScreenMovie.count(object)) {
 		VideoManager()->EnableFullScreenMovie(TRUE);
 	}
 
-	if (std::find(disable3d.begin(), disable3d.end(), object) != disable3d.end()) {
+	if (disable3d.count(object)) {
 		VideoManager()->FUN_1007c520();
 	}
 
@@ -130,7 +130,7 @@ std::optional<MxResult> SiLoader::HandleStart(MxDSAction& p_action)
 
 MxBool SiLoader::HandleWorld(LegoWorld* p_world)
 {
-	StreamObject object{p_world->GetAtomId(), p_world->GetEntityId()};
+	DirectiveKey object = Key(p_world->GetAtomId(), p_world->GetEntityId());
 	auto start = [](const StreamObject& p_object, MxDSAction& p_out) {
 		if (!OpenStream(p_object.first.GetInternal())) {
 			return;
@@ -142,28 +142,26 @@ MxBool SiLoader::HandleWorld(LegoWorld* p_world)
 		Start(&p_out);
 	};
 
-	for (const auto& key : startWith) {
-		if (key.first == object) {
-			MxDSAction action;
-			start(key.second, action);
-		}
+	for (const auto& key : Find(startWith, object)) {
+		MxDSAction action;
+		start(key.second, action);
 	}
 
 	return TRUE;
 }
 
-std::optional<MxBool> SiLoader::HandleRemove(StreamObject p_object, LegoWorld* world)
+std::optional<MxBool> SiLoader::HandleRemove(const StreamObject& p_object, LegoWorld* world)
 {
-	for (const auto& key : removeWith) {
-		if (key.first == p_object) {
-			RemoveFromWorld(key.second.first, key.second.second, world->GetAtomId(), world->GetEntityId());
-		}
+	DirectiveKey object = Key(p_object);
+
+	for (const auto& key : Find(removeWith, object)) {
+		RemoveFromWorld(key.second.first, key.second.second, world->GetAtomId(), world->GetEntityId());
 	}
 
-	for (const auto& key : replace) {
-		if (key.first == p_object) {
-			return RemoveFromWorld(key.second.first, key.second.second, world->GetAtomId(), world->GetEntityId());
-		}
+	const std::vector<Directive>& replaced = Find(replace, object);
+	if (!replaced.empty()) {
+		const StreamObject& key = replaced.front().second;
+		return RemoveFromWorld(key.first, key.second, world->GetAtomId(), world->GetEntityId());
 	}
 
 	return std::nullopt;
@@ -171,7 +169,7 @@ std::optional<MxBool> SiLoader::HandleRemove(StreamObject p_object, LegoWorld* w
 
 std::optional<MxBool> SiLoader::HandleDelete(MxDSAction& p_action)
 {
-	StreamObject object{p_action.GetAtomId(), p_action.GetObjectId()};
+	DirectiveKey object = Key(p_action.GetAtomId(), p_action.GetObjectId());
 	auto deleteObject = [](const StreamObject& p_object, MxDSAction& p_in, MxDSAction& p_out) {
 		p_out.SetAtomId(p_object.first);
 		p_out.SetObjectId(p_object.second);
@@ -181,20 +179,17 @@ std::optional<MxBool> SiLoader::HandleDelete(MxDSAction& p_action)
 		DeleteObject(p_out);
 	};
 
-	for (const auto& key : removeWith) {
-		if (key.first == object) {
-			MxDSAction action;
-			deleteObject(key.second, p_action, action);
-		}
+	for (const auto& key : Find(removeWith, object)) {
+		MxDSAction action;
+		deleteObject(key.second, p_action, action);
 	}
 
-	for (const auto& key : replace) {
-		if (key.first == object) {
-			MxDSAction action;
-			deleteObject(key.second, p_action, action);
-			p_action.SetUnknown24(action.GetUnknown24());
-			return TRUE;
-		}
+	const std::vector<Directive>& replaced = Find(replace, object);
+	if (!replaced.empty()) {
+		MxDSAction action;
+		deleteObject(replaced.front().second, p_action, action);
+		p_action.SetUnknown24(action.GetUnknown24());
+		return TRUE;
 	}
 
 	return std::nullopt;
@@ -202,7 +197,7 @@ std::optional<MxBool> SiLoader::HandleDelete(MxDSAction& p_action)
 
 MxBool SiLoader::HandleEndAction(MxEndActionNotificationParam& p_param)
 {
-	StreamObject object{p_param.GetAction()->GetAtomId(), p_param.GetAction()->GetObjectId()};
+	DirectiveKey object = Key(p_param.GetAction()->GetAtomId(), p_param.GetAction()->GetObjectId());
 	auto start = [](const StreamObject& p_object, MxDSAction& p_in, MxDSAction& p_out) -> MxResult {
 		if (!OpenStream(p_object.first.GetInternal())) {
 			return FAILURE;
@@ -217,16 +212,14 @@ MxBool SiLoader::HandleEndAction(MxEndActionNotificationParam& p_param)
 		return Start(&p_out);
 	};
 
-	if (std::find(fullScreenMovie.begin(), fullScreenMovie.end(), object) != fullScreenMovie.end()) {
+	if (fullScreenMovie.count(object)) {
 		VideoManager()->EnableFullScreenMovie(FALSE);
 	}
 
 	if (!p_param.GetSender() || !p_param.GetSender()->IsA("MxCompositePresenter")) {
-		for (const auto& key : prepend) {
-			if (key.second == object) {
-				MxDSAction action;
-				start(key.first, *p_param.GetAction(), action);
-			}
+		for (const auto& key : Find(prependedTo, object)) {
+			MxDSAction action;
+			start(key.first, *p_param.GetAction(), action);
 		}
 	}
 
@@ -271,34 +264,42 @@ bool SiLoader::LoadDirective(const char* p_directive)
 			targetAtom,
 			&targetId
 		) == 4) {
-		startWith.emplace_back(
+		AddDirective(
+			startWith,
+			NULL,
 			StreamObject{MxAtomId{originAtom, e_lowerCase2}, originId},
 			StreamObject{MxAtomId{targetAtom, e_lowerCase2}, targetId}
 		);
 	}
 	else if (SDL_sscanf(p_directive, "RemoveWith:%255[^:;]%*[:;]%u%*[:;]%255[^:;]%*[:;]%u", originAtom, &originId, targetAtom, &targetId) == 4) {
-		removeWith.emplace_back(
+		AddDirective(
+			removeWith,
+			NULL,
 			StreamObject{MxAtomId{originAtom, e_lowerCase2}, originId},
 			StreamObject{MxAtomId{targetAtom, e_lowerCase2}, targetId}
 		);
 	}
 	else if (SDL_sscanf(p_directive, "Replace:%255[^:;]%*[:;]%u%*[:;]%255[^:;]%*[:;]%u", originAtom, &originId, targetAtom, &targetId) == 4) {
-		replace.emplace_back(
+		AddDirective(
+			replace,
+			&replacedBy,
 			StreamObject{MxAtomId{originAtom, e_lowerCase2}, originId},
 			StreamObject{MxAtomId{targetAtom, e_lowerCase2}, targetId}
 		);
 	}
 	else if (SDL_sscanf(p_directive, "Prepend:%255[^:;]%*[:;]%u%*[:;]%255[^:;]%*[:;]%u", originAtom, &originId, targetAtom, &targetId) == 4) {
-		prepend.emplace_back(
+		AddDirective(
+			prepend,
+			&prependedTo,
 			StreamObject{MxAtomId{targetAtom, e_lowerCase2}, targetId},
 			StreamObject{MxAtomId{originAtom, e_lowerCase2}, originId}
 		);
 	}
 	else if (SDL_sscanf(p_directive, "FullScreenMovie:%255[^:;]%*[:;]%u", originAtom, &originId) == 2) {
-		fullScreenMovie.emplace_back(StreamObject{MxAtomId{originAtom, e_lowerCase2}, originId});
+		AddObject(fullScreenMovie, StreamObject{MxAtomId{originAtom, e_lowerCase2}, originId});
 	}
 	else if (SDL_sscanf(p_directive, "Disable3d:%255[^:;]%*[:;]%u", originAtom, &originId) == 2) {
-		disable3d.emplace_back(StreamObject{MxAtomId{originAtom, e_lowerCase2}, originId});
+		AddObject(disable3d, StreamObject{MxAtomId{originAtom, e_lowerCase2}, originId});
 	}
 
 	return true;
@@ -328,7 +329,9 @@ void SiLoader::ParseExtra(const MxAtomId& p_atom, si::Core* p_core)
 
 				if ((directive = SDL_strstr(extra.c_str(), "StartWith:"))) {
 					if (SDL_sscanf(directive, "StartWith:%255[^:;]%*[:;]%u", atom, &id) == 2) {
-						startWith.emplace_back(
+						AddDirective(
+							startWith,
+							NULL,
 							StreamObject{MxAtomId{atom, e_lowerCase2}, id},
 							StreamObject{p_atom, object->id_}
 						);
@@ -337,7 +340,9 @@ void SiLoader::ParseExtra(const MxAtomId& p_atom, si::Core* p_core)
 
 				if ((directive = SDL_strstr(extra.c_str(), "RemoveWith:"))) {
 					if (SDL_sscanf(directive, "RemoveWith:%255[^:;]%*[:;]%u", atom, &id) == 2) {
-						removeWith.emplace_back(
+						AddDirective(
+							removeWith,
+							NULL,
 							StreamObject{MxAtomId{atom, e_lowerCase2}, id},
 							StreamObject{p_atom, object->id_}
 						);
@@ -346,7 +351,9 @@ void SiLoader::ParseExtra(const MxAtomId& p_atom, si::Core* p_core)
 
 				if ((directive = SDL_strstr(extra.c_str(), "Replace:"))) {
 					if (SDL_sscanf(directive, "Replace:%255[^:;]%*[:;]%u", atom, &id) == 2) {
-						replace.emplace_back(
+						AddDirective(
+							replace,
+							&replacedBy,
 							StreamObject{MxAtomId{atom, e_lowerCase2}, id},
 							StreamObject{p_atom, object->id_}
 						);
@@ -355,7 +362,9 @@ void SiLoader::ParseExtra(const MxAtomId& p_atom, si::Core* p_core)
 
 				if ((directive = SDL_strstr(extra.c_str(), "Prepend:"))) {
 					if (SDL_sscanf(directive, "Prepend:%255[^:;]%*[:;]%u", atom, &id) == 2) {
-						prepend.emplace_back(
+						AddDirective(
+							prepend,
+							&prependedTo,
 							StreamObject{p_atom, object->id_},
 							StreamObject{MxAtomId{atom, e_lowerCase2}, id}
 						);
@@ -363,11 +372,11 @@ void SiLoader::ParseExtra(const MxAtomId& p_atom, si::Core* p_core)
 				}
 
 				if ((directive = SDL_strstr(extra.c_str(), "FullScreenMovie"))) {
-					fullScreenMovie.emplace_back(StreamObject{MxAtomId{atom, e_lowerCase2}, id});
+					AddObject(fullScreenMovie, StreamObject{MxAtomId{atom, e_lowerCase2}, id});
 				}
 
 				if ((directive = SDL_strstr(extra.c_str(), "Disable3d"))) {
-					disable3d.emplace_back(StreamObject{MxAtomId{atom, e_lowerCase2}, id});
+					AddObject(disable3d, StreamObject{MxAtomId{atom, e_lowerCase2}, id});
 				}
 			}
 		}
@@ -376,6 +385,35 @@ void SiLoader::ParseExtra(const MxAtomId& p_atom, si::Core* p_core)
 	}
 }
 
+const std::vector<SiLoader::Directive>& SiLoader::Find(const DirectiveMap& p_map, const DirectiveKey& p_key)
+{
+	static const std::vector<Directive> none;
+
+	DirectiveMap::const_iterator it = p_map.find(p_key);
+	return it != p_map.end() ? it->second : none;
+}
+
+// The directive keeps both atoms referenced, so the keys' atom pointers stay valid
+void SiLoader::AddDirective(
+	DirectiveMap& p_map,
+	DirectiveMap* p_reverseMap,
+	const StreamObject& p_origin,
+	const StreamObject& p_target
+)
+{
+	Directive directive(p_origin, p_target);
+	p_map[Key(p_origin)].push_back(directive);
+
+	if (p_reverseMap) {
+		(*p_reverseMap)[Key(p_target)].push_back(directive);
+	}
+}
+
+void SiLoader::AddObject(ObjectMap& p_map, const StreamObject& p_object)
+{
+	p_map.emplace(Key(p_object), p_object);
+}
+
 bool SiLoader::IsWorld(const StreamObject& p_object)
 {
 	// The convention in LEGO Island is that world objects are always at ID 0
@@ -1,10 +1,26 @@
 #include "extensions/textureloader.h"
 
+#include <SDL3/SDL_filesystem.h>
+#include <algorithm>
+
 using namespace Extensions;
 
 std::map<std::string, std::string> TextureLoader::options;
 std::vector<std::string> TextureLoader::excludedFiles;
 bool TextureLoader::enabled = false;
+std::unordered_map<std::string, std::string> TextureLoader::textureFiles;
+bool TextureLoader::indexed = false;
+TextureLoader::SurfaceCache TextureLoader::cache;
+std::unordered_map<std::string, TextureLoader::SurfaceCache::iterator> TextureLoader::cacheIndex;
+size_t TextureLoader::cacheBytes = 0;
+size_t TextureLoader::cacheLimit = 0;
+
+static std::string ToLower(const char* p_name)
+{
+	std::string name(p_name);
+	std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return SDL_tolower(c); });
+	return name;
+}
 
 void TextureLoader::Initialize()
 {
@@ -13,16 +29,30 @@ void TextureLoader::Initialize()
 			options[option.first.data()] = option.second;
 		}
 	}
+
+	cacheLimit = SDL_strtoul(options["texture loader:cache size"].c_str(), NULL, 10) * 1024 * 1024;
 }
 
 bool TextureLoader::PatchTexture(LegoTextureInfo* p_textureInfo)
 {
-	SDL_Surface* surface = FindTexture(p_textureInfo->m_name);
+	bool owned;
+	SDL_Surface* surface = FindTexture(p_textureInfo->m_name, owned);
 	if (!surface) {
 		return false;
 	}
 
-	const SDL_PixelFormatDetails* details = SDL_GetPixelFormatDetails(surface->format);
+	bool result = CopyTexture(p_textureInfo, surface);
+
+	if (owned) {
+		SDL_DestroySurface(surface);
+	}
+
+	return result;
+}
+
+bool TextureLoader::CopyTexture(LegoTextureInfo* p_textureInfo, SDL_Surface* p_surface)
+{
+	const SDL_PixelFormatDetails* details = SDL_GetPixelFormatDetails(p_surface->format);
 
 	DDSURFACEDESC desc;
 	memset(&desc, 0, sizeof(desc));
@@ -30,8 +60,8 @@ bool TextureLoader::PatchTexture(LegoTextureInfo* p_textureInfo)
 	desc.dwFlags = DDSD_PIXELFORMAT | DDSD_WIDTH | DDSD_HEIGHT | DDSD_CAPS;
 	desc.ddsCaps.dwCaps = DDSCAPS_TEXTURE | DDSCAPS_SYSTEMMEMORY;
 	desc.ddpfPixelFormat.dwSize = sizeof(desc.ddpfPixelFormat);
-	desc.dwWidth = surface->w;
-	desc.dwHeight = surface->h;
+	desc.dwWidth = p_surface->w;
+	desc.dwHeight = p_surface->h;
 	desc.ddpfPixelFormat.dwFlags = DDPF_RGB | DDPF_ALPHAPIXELS;
 	desc.ddpfPixelFormat.dwRGBBitCount = details->bits_per_pixel;
 	desc.ddpfPixelFormat.dwRBitMask = details->Rmask;
@@ -41,7 +71,6 @@ bool TextureLoader::PatchTexture(LegoTextureInfo* p_textureInfo)
 
 	LPDIRECTDRAW pDirectDraw = VideoManager()->GetDirect3D()->DirectDraw();
 	if (pDirectDraw->CreateSurface(&desc, &p_textureInfo->m_surface, NULL) != DD_OK) {
-		SDL_DestroySurface(surface);
 		return false;
 	}
 
@@ -49,17 +78,15 @@ bool TextureLoader::PatchTexture(LegoTextureInfo* p_textureInfo)
 	desc.dwSize = sizeof(desc);
 
 	if (p_textureInfo->m_surface->Lock(NULL, &desc, DDLOCK_SURFACEMEMORYPTR | DDLOCK_WRITEONLY, NULL) != DD_OK) {
-		SDL_DestroySurface(surface);
 		return false;
 	}
 
 	MxU8* dst = (MxU8*) desc.lpSurface;
-	Uint8* srcPixels = (Uint8*) surface->pixels;
+	Uint8* srcPixels = (Uint8*) p_surface->pixels;
 
 	if (details->bits_per_pixel == 8) {
-		SDL_Palette* sdlPalette = SDL_GetSurfacePalette(surface);
+		SDL_Palette* sdlPalette = SDL_GetSurfacePalette(p_surface);
 		if (!sdlPalette) {
-			SDL_DestroySurface(surface);
 			return false;
 		}
 
@@ -73,7 +100,6 @@ bool TextureLoader::PatchTexture(LegoTextureInfo* p_textureInfo)
 
 		LPDIRECTDRAWPALETTE ddPalette = nullptr;
 		if (pDirectDraw->CreatePalette(DDPCAPS_8BIT | DDPCAPS_ALLOW256, entries, &ddPalette, NULL) != DD_OK) {
-			SDL_DestroySurface(surface);
 			return false;
 		}
 
@@ -81,37 +107,106 @@ bool TextureLoader::PatchTexture(LegoTextureInfo* p_textureInfo)
 		ddPalette->Release();
 	}
 
-	memcpy(dst, srcPixels, surface->pitch * surface->h);
+	memcpy(dst, srcPixels, p_surface->pitch * p_surface->h);
 	p_textureInfo->m_surface->Unlock(desc.lpSurface);
 	p_textureInfo->m_palette = NULL;
 
 	if (((TglImpl::RendererImpl*) VideoManager()->GetRenderer())
 			->CreateTextureFromSurface(p_textureInfo->m_surface, &p_textureInfo->m_texture) != D3DRM_OK) {
-		SDL_DestroySurface(surface);
 		return false;
 	}
 
 	p_textureInfo->m_texture->SetAppData((LPD3DRM_APPDATA) p_textureInfo);
-	SDL_DestroySurface(surface);
 	return true;
 }
 
-SDL_Surface* TextureLoader::FindTexture(const char* p_name)
+// Sets p_owned if the caller must destroy the returned surface. Otherwise it is owned by
+// the cache and stays valid until the next call.
+SDL_Surface* TextureLoader::FindTexture(const char* p_name, bool& p_owned)
 {
-	if (std::find(excludedFiles.begin(), excludedFiles.end(), p_name) != excludedFiles.end()) {
+	p_owned = false;
+
+	if (!indexed) {
+		IndexTextures();
+	}
+
+	std::string name = ToLower(p_name);
+
+	auto cached = cacheIndex.find(name);
+	if (cached != cacheIndex.end()) {
+		cache.splice(cache.begin(), cache, cached->second);
+		return cached->second->second;
+	}
+
+	auto file = textureFiles.find(name);
+	if (file == textureFiles.end()) {
+		return nullptr;
+	}
+
+	SDL_Surface* surface = SDL_LoadBMP(file->second.c_str());
+	if (!surface) {
+		SDL_Log("Failed to load texture override %s: %s", file->second.c_str(), SDL_GetError());
+		textureFiles.erase(file);
 		return nullptr;
 	}
 
-	SDL_Surface* surface;
-	const char* texturePath = options["texture loader:texture path"].c_str();
-	MxString path = MxString(MxOmni::GetHD()) + texturePath + "/" + p_name + ".bmp";
+	size_t bytes = (size_t) surface->pitch * surface->h;
+	if (bytes > cacheLimit) {
+		p_owned = true;
+		return surface;
+	}
+
+	cache.emplace_front(name, surface);
+	cacheIndex[name] = cache.begin();
+	cacheBytes += bytes;
 
-	path.MapPathToFilesystem();
-	if (!(surface = SDL_LoadBMP(path.GetData()))) {
-		path = MxString(MxOmni::GetCD()) + texturePath + "/" + p_name + ".bmp";
-		path.MapPathToFilesystem();
-		surface = SDL_LoadBMP(path.GetData());
+	while (cacheBytes > cacheLimit) {
+		SDL_Surface* evicted = cache.back().second;
+		cacheBytes -= (size_t) evicted->pitch * evicted->h;
+		SDL_DestroySurface(evicted);
+		cacheIndex.erase(cache.back().first);
+		cache.pop_back();
 	}
 
 	return surface;
 }
+
+// Lists the override directories once instead of probing the disk for every texture.
+// Overrides on the HD take precedence over those on the CD.
+void TextureLoader::IndexTextures()
+{
+	IndexDirectory(MxOmni::GetCD());
+	IndexDirectory(MxOmni::GetHD());
+
+	for (const std::string& file : excludedFiles) {
+		textureFiles.erase(ToLower(file.c_str()));
+	}
+
+	indexed = true;
+	SDL_Log("Found %d texture overrides", (int) textureFiles.size());
+}
+
+void TextureLoader::IndexDirectory(const char* p_base)
+{
+	MxString directory = MxString(p_base) + options["texture loader:texture path"].c_str();
+	directory.MapPathToFilesystem();
+
+	int count;
+	char** files = SDL_GlobDirectory(directory.GetData(), "*.bmp", SDL_GLOB_CASEINSENSITIVE, &count);
+	if (files == NULL) {
+		return;
+	}
+
+	for (int i = 0; i < count; i++) {
+		const char* file = files[i];
+		if (SDL_strchr(file, '/') || SDL_strchr(file, '\\')) {
+			continue;
+		}
+
+		std::string name = ToLower(file);
+		name.resize(name.size() - 4);
+		textureFiles[name] = std::string(directory.GetData()) + "/" + file;
+	}
+
+	SDL_free(files);
+}
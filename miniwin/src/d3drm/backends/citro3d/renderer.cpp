@@ -304,8 +304,11 @@ C3DMeshCacheEntry C3DUploadMesh(const MeshGroup& meshGroup)
 
 	std::vector<D3DRMVERTEX> vertexBuffer;
 	std::vector<uint16_t> indexBuffer;
+	bool flat = meshGroup.quality == D3DRMRENDER_FLAT || meshGroup.quality == D3DRMRENDER_UNLITFLAT;
+	const D3DRMVERTEX* vertices = meshGroup.vertices.data();
+	size_t indexCount = meshGroup.indices.size();
 
-	if (meshGroup.quality == D3DRMRENDER_FLAT || meshGroup.quality == D3DRMRENDER_UNLITFLAT) {
+	if (flat) {
 		FlattenSurfaces(
 			meshGroup.vertices.data(),
 			meshGroup.vertices.size(),
@@ -315,24 +318,20 @@ C3DMeshCacheEntry C3DUploadMesh(const MeshGroup& meshGroup)
 			vertexBuffer,
 			indexBuffer
 		);
-	}
-	else {
-		vertexBuffer.assign(meshGroup.vertices.begin(), meshGroup.vertices.end());
-		indexBuffer.assign(meshGroup.indices.begin(), meshGroup.indices.end());
+		vertices = vertexBuffer.data();
+		indexCount = indexBuffer.size();
 	}
 
 	// Flatten vertices as IBO is buggy on 3DS hardware
-	std::vector<D3DRMVERTEX> vertexUploadBuffer;
-	vertexUploadBuffer.reserve(indexBuffer.size());
+	size_t vertexBufferSize = indexCount * sizeof(D3DRMVERTEX);
+	cache.vbo = linearAlloc(vertexBufferSize);
+	D3DRMVERTEX* vbo = static_cast<D3DRMVERTEX*>(cache.vbo);
 
-	for (size_t i = 0; i < indexBuffer.size(); ++i) {
-		vertexUploadBuffer.emplace_back(vertexBuffer[indexBuffer[i]]);
+	for (size_t i = 0; i < indexCount; ++i) {
+		vbo[i] = vertices[flat ? indexBuffer[i] : meshGroup.indices[i]];
 	}
 
-	size_t vertexBufferSize = vertexUploadBuffer.size() * sizeof(D3DRMVERTEX);
-	cache.vbo = linearAlloc(vertexBufferSize);
-	memcpy(cache.vbo, vertexUploadBuffer.data(), vertexBufferSize);
-	cache.vertexCount = vertexUploadBuffer.size();
+	cache.vertexCount = indexCount;
 
 	return cache;
 }
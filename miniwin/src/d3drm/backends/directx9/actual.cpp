@@ -86,10 +86,15 @@ void Actual_SetProjection(const Matrix4x4* projection, float front, float back)
 	memcpy(&g_projection, projection, sizeof(Matrix4x4));
 }
 
+// Expects an ARGB8888 surface
 IDirect3DTexture9* UploadSurfaceToD3DTexture(SDL_Surface* surface)
 {
 	IDirect3DTexture9* texture;
 
+	if (!surface) {
+		return nullptr;
+	}
+
 	HRESULT hr =
 		g_device->CreateTexture(surface->w, surface->h, 1, 0, D3DFMT_A8R8G8B8, D3DPOOL_MANAGED, &texture, nullptr);
 
@@ -97,25 +102,18 @@ IDirect3DTexture9* UploadSurfaceToD3DTexture(SDL_Surface* surface)
 		return nullptr;
 	}
 
-	SDL_Surface* conv = SDL_ConvertSurface(surface, SDL_PIXELFORMAT_ARGB8888);
-	if (!conv) {
-		texture->Release();
-		return nullptr;
-	}
-
 	D3DLOCKED_RECT lockedRect;
 	texture->LockRect(0, &lockedRect, nullptr, 0);
 
-	for (int y = 0; y < conv->h; ++y) {
+	for (int y = 0; y < surface->h; ++y) {
 		memcpy(
 			(uint8_t*) lockedRect.pBits + y * lockedRect.Pitch,
-			(uint8_t*) conv->pixels + y * conv->pitch,
-			conv->w * 4
+			(uint8_t*) surface->pixels + y * surface->pitch,
+			surface->w * 4
 		);
 	}
 
 	texture->UnlockRect(0);
-	SDL_DestroySurface(conv);
 
 	return texture;
 }
@@ -79,7 +79,6 @@ void DirectX9Renderer::AddTextureDestroyCallback(Uint32 id, IDirect3DRMTexture*
 Uint32 DirectX9Renderer::GetTextureId(IDirect3DRMTexture* iTexture, bool isUI, float scaleX, float scaleY)
 {
 	auto texture = static_cast<Direct3DRMTextureImpl*>(iTexture);
-	auto surface = static_cast<DirectDrawSurfaceImpl*>(texture->m_surface);
 
 	for (Uint32 i = 0; i < m_textures.size(); ++i) {
 		auto& tex = m_textures[i];
@@ -89,7 +88,8 @@ Uint32 DirectX9Renderer::GetTextureId(IDirect3DRMTexture* iTexture, bool isUI, f
 					ReleaseD3DTexture(tex.dxTexture);
 					tex.dxTexture = nullptr;
 				}
-				tex.dxTexture = UploadSurfaceToD3DTexture(surface->m_surface);
+				tex.dxTexture = UploadSurfaceToD3DTexture(texture->GetConvertedSurface(SDL_PIXELFORMAT_ARGB8888));
+				texture->ReleaseConvertedSurface();
 				if (!tex.dxTexture) {
 					return NO_TEXTURE_ID;
 				}
@@ -99,7 +99,8 @@ Uint32 DirectX9Renderer::GetTextureId(IDirect3DRMTexture* iTexture, bool isUI, f
 		}
 	}
 
-	IDirect3DTexture9* newTex = UploadSurfaceToD3DTexture(surface->m_surface);
+	IDirect3DTexture9* newTex = UploadSurfaceToD3DTexture(texture->GetConvertedSurface(SDL_PIXELFORMAT_ARGB8888));
+	texture->ReleaseConvertedSurface();
 	if (!newTex) {
 		return NO_TEXTURE_ID;
 	}
@@ -127,7 +128,7 @@ D3D9MeshCacheEntry UploadD3D9Mesh(const MeshGroup& meshGroup)
 	cache.version = meshGroup.version;
 	cache.flat = meshGroup.quality == D3DRMRENDER_FLAT || meshGroup.quality == D3DRMRENDER_UNLITFLAT;
 
-	std::vector<D3DRMVERTEX> vertices;
+	std::vector<D3DRMVERTEX> flatVertices;
 	std::vector<uint16_t> indices;
 
 	if (cache.flat) {
@@ -137,18 +138,19 @@ D3D9MeshCacheEntry UploadD3D9Mesh(const MeshGroup& meshGroup)
 			meshGroup.indices.data(),
 			meshGroup.indices.size(),
 			meshGroup.texture != nullptr,
-			vertices,
+			flatVertices,
 			indices
 		);
 	}
 	else {
-		vertices = meshGroup.vertices;
 		indices.resize(meshGroup.indices.size());
 		std::transform(meshGroup.indices.begin(), meshGroup.indices.end(), indices.begin(), [](DWORD i) {
 			return static_cast<uint16_t>(i);
 		});
 	}
 
+	const std::vector<D3DRMVERTEX>& vertices = cache.flat ? flatVertices : meshGroup.vertices;
+
 	cache.indexCount = indices.size();
 	cache.vertexCount = vertices.size();
 
@@ -124,15 +124,11 @@ static int NextPowerOfTwo(int v)
 	return power;
 }
 
-static Uint32 UploadTextureData(SDL_Surface* src, bool useNPOT, bool isUI, float scaleX, float scaleY)
+static Uint32 UploadTextureData(Direct3DRMTextureImpl* texture, bool useNPOT, bool isUI, float scaleX, float scaleY)
 {
-	SDL_Surface* working = src;
-	if (src->format != SDL_PIXELFORMAT_RGBA32) {
-		working = SDL_ConvertSurface(src, SDL_PIXELFORMAT_RGBA32);
-		if (!working) {
-			SDL_Log("SDL_ConvertSurface failed: %s", SDL_GetError());
-			return NO_TEXTURE_ID;
-		}
+	SDL_Surface* working = texture->GetConvertedSurface(SDL_PIXELFORMAT_RGBA32);
+	if (!working) {
+		return NO_TEXTURE_ID;
 	}
 
 	SDL_Surface* finalSurface = working;
@@ -155,26 +151,21 @@ static Uint32 UploadTextureData(SDL_Surface* src, bool useNPOT, bool isUI, float
 		SDL_Surface* resized = SDL_CreateSurface(newW, newH, working->format);
 		if (!resized) {
 			SDL_Log("SDL_CreateSurface (resize) failed: %s", SDL_GetError());
-			if (working != src) {
-				SDL_DestroySurface(working);
-			}
+			texture->ReleaseConvertedSurface();
 			return NO_TEXTURE_ID;
 		}
 
 		SDL_Rect srcRect = {0, 0, working->w, working->h};
 		SDL_Rect dstRect = {0, 0, newW, newH};
 		SDL_BlitSurfaceScaled(working, &srcRect, resized, &dstRect, SDL_SCALEMODE_NEAREST);
-
-		if (working != src) {
-			SDL_DestroySurface(working);
-		}
 		finalSurface = resized;
 	}
 
 	Uint32 texId = GL11_UploadTextureData(finalSurface->pixels, finalSurface->w, finalSurface->h, isUI, scaleX, scaleY);
-	if (finalSurface != src) {
+	if (finalSurface != working) {
 		SDL_DestroySurface(finalSurface);
 	}
+	texture->ReleaseConvertedSurface();
 	return texId;
 }
 
@@ -189,7 +180,7 @@ Uint32 OpenGL1Renderer::GetTextureId(IDirect3DRMTexture* iTexture, bool isUI, fl
 		if (tex.texture == texture) {
 			if (tex.version != texture->m_version) {
 				GL11_DestroyTexture(tex.glTextureId);
-				tex.glTextureId = UploadTextureData(surface->m_surface, m_useNPOT, isUI, scaleX, scaleY);
+				tex.glTextureId = UploadTextureData(texture, m_useNPOT, isUI, scaleX, scaleY);
 				tex.version = texture->m_version;
 				tex.width = surface->m_surface->w;
 				tex.height = surface->m_surface->h;
@@ -198,7 +189,7 @@ Uint32 OpenGL1Renderer::GetTextureId(IDirect3DRMTexture* iTexture, bool isUI, fl
 		}
 	}
 
-	GLuint texId = UploadTextureData(surface->m_surface, m_useNPOT, isUI, scaleX, scaleY);
+	GLuint texId = UploadTextureData(texture, m_useNPOT, isUI, scaleX, scaleY);
 
 	for (Uint32 i = 0; i < m_textures.size(); ++i) {
 		auto& tex = m_textures[i];
@@ -230,7 +221,7 @@ GLMeshCacheEntry GLUploadMesh(const MeshGroup& meshGroup, bool useVBOs)
 
 	cache.flat = meshGroup.quality == D3DRMRENDER_FLAT || meshGroup.quality == D3DRMRENDER_UNLITFLAT;
 
-	std::vector<D3DRMVERTEX> vertices;
+	std::vector<D3DRMVERTEX> flatVertices;
 	if (cache.flat) {
 		FlattenSurfaces(
 			meshGroup.vertices.data(),
@@ -238,18 +229,19 @@ GLMeshCacheEntry GLUploadMesh(const MeshGroup& meshGroup, bool useVBOs)
 			meshGroup.indices.data(),
 			meshGroup.indices.size(),
 			meshGroup.texture != nullptr,
-			vertices,
+			flatVertices,
 			cache.indices
 		);
 	}
 	else {
-		vertices = meshGroup.vertices;
 		cache.indices.resize(meshGroup.indices.size());
 		std::transform(meshGroup.indices.begin(), meshGroup.indices.end(), cache.indices.begin(), [](DWORD index) {
 			return static_cast<uint16_t>(index);
 		});
 	}
 
+	const std::vector<D3DRMVERTEX>& vertices = cache.flat ? flatVertices : meshGroup.vertices;
+
 	if (meshGroup.texture) {
 		cache.texcoords.resize(vertices.size());
 		std::transform(vertices.begin(), vertices.end(), cache.texcoords.begin(), [](const D3DRMVERTEX& v) {
@@ -186,7 +186,7 @@ GLES2MeshCacheEntry GLES2UploadMesh(const MeshGroup& meshGroup, bool forceUV = f
 
 	cache.flat = meshGroup.quality == D3DRMRENDER_FLAT || meshGroup.quality == D3DRMRENDER_UNLITFLAT;
 
-	std::vector<D3DRMVERTEX> vertices;
+	std::vector<D3DRMVERTEX> flatVertices;
 	if (cache.flat) {
 		FlattenSurfaces(
 			meshGroup.vertices.data(),
@@ -194,18 +194,19 @@ GLES2MeshCacheEntry GLES2UploadMesh(const MeshGroup& meshGroup, bool forceUV = f
 			meshGroup.indices.data(),
 			meshGroup.indices.size(),
 			meshGroup.texture != nullptr || forceUV,
-			vertices,
+			flatVertices,
 			cache.indices
 		);
 	}
 	else {
-		vertices = meshGroup.vertices;
 		cache.indices.resize(meshGroup.indices.size());
 		std::transform(meshGroup.indices.begin(), meshGroup.indices.end(), cache.indices.begin(), [](DWORD index) {
 			return static_cast<uint16_t>(index);
 		});
 	}
 
+	const std::vector<D3DRMVERTEX>& vertices = cache.flat ? flatVertices : meshGroup.vertices;
+
 	std::vector<TexCoord> texcoords;
 	if (meshGroup.texture || forceUV) {
 		texcoords.resize(vertices.size());
@@ -246,14 +247,11 @@ GLES2MeshCacheEntry GLES2UploadMesh(const MeshGroup& meshGroup, bool forceUV = f
 	return cache;
 }
 
-bool OpenGLES2Renderer::UploadTexture(SDL_Surface* source, GLuint& outTexId, bool isUI)
+// Expects an RGBA32 surface
+bool OpenGLES2Renderer::UploadTexture(SDL_Surface* surf, GLuint& outTexId, bool isUI)
 {
-	SDL_Surface* surf = source;
-	if (source->format != SDL_PIXELFORMAT_RGBA32) {
-		surf = SDL_ConvertSurface(source, SDL_PIXELFORMAT_RGBA32);
-		if (!surf) {
-			return false;
-		}
+	if (!surf) {
+		return false;
 	}
 
 	glGenTextures(1, &outTexId);
@@ -277,10 +275,6 @@ bool OpenGLES2Renderer::UploadTexture(SDL_Surface* source, GLuint& outTexId, boo
 		glGenerateMipmap(GL_TEXTURE_2D);
 	}
 
-	if (surf != source) {
-		SDL_DestroySurface(surf);
-	}
-
 	return true;
 }
 
@@ -432,7 +426,10 @@ Uint32 OpenGLES2Renderer::GetTextureId(IDirect3DRMTexture* iTexture, bool isUI,
 		if (tex.texture == texture) {
 			if (tex.version != texture->m_version) {
 				glDeleteTextures(1, &tex.glTextureId);
-				if (UploadTexture(surface->m_surface, tex.glTextureId, isUI)) {
+				bool uploaded =
+					UploadTexture(texture->GetConvertedSurface(SDL_PIXELFORMAT_RGBA32), tex.glTextureId, isUI);
+				texture->ReleaseConvertedSurface();
+				if (uploaded) {
 					tex.version = texture->m_version;
 				}
 			}
@@ -441,7 +438,9 @@ Uint32 OpenGLES2Renderer::GetTextureId(IDirect3DRMTexture* iTexture, bool isUI,
 	}
 
 	GLuint texId;
-	if (!UploadTexture(surface->m_surface, texId, isUI)) {
+	bool uploaded = UploadTexture(texture->GetConvertedSurface(SDL_PIXELFORMAT_RGBA32), texId, isUI);
+	texture->ReleaseConvertedSurface();
+	if (!uploaded) {
 		return NO_TEXTURE_ID;
 	}
 
@@ -188,7 +188,7 @@ GLES3MeshCacheEntry OpenGLES3Renderer::GLES3UploadMesh(const MeshGroup& meshGrou
 
 	cache.flat = meshGroup.quality == D3DRMRENDER_FLAT || meshGroup.quality == D3DRMRENDER_UNLITFLAT;
 
-	std::vector<D3DRMVERTEX> vertices;
+	std::vector<D3DRMVERTEX> flatVertices;
 	if (cache.flat) {
 		FlattenSurfaces(
 			meshGroup.vertices.data(),
@@ -196,18 +196,19 @@ GLES3MeshCacheEntry OpenGLES3Renderer::GLES3UploadMesh(const MeshGroup& meshGrou
 			meshGroup.indices.data(),
 			meshGroup.indices.size(),
 			meshGroup.texture != nullptr || forceUV,
-			vertices,
+			flatVertices,
 			cache.indices
 		);
 	}
 	else {
-		vertices = meshGroup.vertices;
 		cache.indices.resize(meshGroup.indices.size());
 		std::transform(meshGroup.indices.begin(), meshGroup.indices.end(), cache.indices.begin(), [](DWORD index) {
 			return static_cast<uint16_t>(index);
 		});
 	}
 
+	const std::vector<D3DRMVERTEX>& vertices = cache.flat ? flatVertices : meshGroup.vertices;
+
 	std::vector<TexCoord> texcoords;
 	if (meshGroup.texture || forceUV) {
 		texcoords.resize(vertices.size());
@@ -259,14 +260,11 @@ GLES3MeshCacheEntry OpenGLES3Renderer::GLES3UploadMesh(const MeshGroup& meshGrou
 	return cache;
 }
 
-bool OpenGLES3Renderer::UploadTexture(SDL_Surface* source, GLuint& outTexId, bool isUI)
+// Expects an RGBA32 surface
+bool OpenGLES3Renderer::UploadTexture(SDL_Surface* surf, GLuint& outTexId, bool isUI)
 {
-	SDL_Surface* surf = source;
-	if (source->format != SDL_PIXELFORMAT_RGBA32) {
-		surf = SDL_ConvertSurface(source, SDL_PIXELFORMAT_RGBA32);
-		if (!surf) {
-			return false;
-		}
+	if (!surf) {
+		return false;
 	}
 
 	glGenTextures(1, &outTexId);
@@ -290,10 +288,6 @@ bool OpenGLES3Renderer::UploadTexture(SDL_Surface* source, GLuint& outTexId, boo
 		glGenerateMipmap(GL_TEXTURE_2D);
 	}
 
-	if (surf != source) {
-		SDL_DestroySurface(surf);
-	}
-
 	return true;
 }
 
@@ -468,7 +462,10 @@ Uint32 OpenGLES3Renderer::GetTextureId(IDirect3DRMTexture* iTexture, bool isUI,
 		if (tex.texture == texture) {
 			if (tex.version != texture->m_version) {
 				glDeleteTextures(1, &tex.glTextureId);
-				if (UploadTexture(surface->m_surface, tex.glTextureId, isUI)) {
+				bool uploaded =
+					UploadTexture(texture->GetConvertedSurface(SDL_PIXELFORMAT_RGBA32), tex.glTextureId, isUI);
+				texture->ReleaseConvertedSurface();
+				if (uploaded) {
 					tex.version = texture->m_version;
 				}
 			}
@@ -477,7 +474,9 @@ Uint32 OpenGLES3Renderer::GetTextureId(IDirect3DRMTexture* iTexture, bool isUI,
 	}
 
 	GLuint texId;
-	if (!UploadTexture(surface->m_surface, texId, isUI)) {
+	bool uploaded = UploadTexture(texture->GetConvertedSurface(SDL_PIXELFORMAT_RGBA32), texId, isUI);
+	texture->ReleaseConvertedSurface();
+	if (!uploaded) {
 		return NO_TEXTURE_ID;
 	}
 
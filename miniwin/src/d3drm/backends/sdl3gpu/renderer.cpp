@@ -10,17 +10,6 @@
 #include <cmath>
 #include <cstddef>
 
-struct ScopedSurface {
-	SDL_Surface* ptr = nullptr;
-	~ScopedSurface()
-	{
-		if (ptr) {
-			SDL_DestroySurface(ptr);
-		}
-	}
-	void release() { ptr = nullptr; }
-};
-
 struct ScopedTexture {
 	SDL_GPUDevice* dev;
 	SDL_GPUTexture* ptr = nullptr;
@@ -436,22 +425,21 @@ void Direct3DRMSDL3GPURenderer::AddTextureDestroyCallback(Uint32 id, IDirect3DRM
 	);
 }
 
+// Expects an RGBA32 surface
 SDL_GPUTexture* Direct3DRMSDL3GPURenderer::CreateTextureFromSurface(SDL_Surface* surface)
 {
-	ScopedSurface surf{SDL_ConvertSurface(surface, SDL_PIXELFORMAT_RGBA32)};
-	if (!surf.ptr) {
-		SDL_LogError(LOG_CATEGORY_MINIWIN, "SDL_ConvertSurface (%s)", SDL_GetError());
+	if (!surface) {
 		return nullptr;
 	}
 
-	const Uint32 dataSize = surf.ptr->pitch * surf.ptr->h;
+	const Uint32 dataSize = surface->pitch * surface->h;
 
 	SDL_GPUTextureCreateInfo textureInfo = {};
 	textureInfo.type = SDL_GPU_TEXTURETYPE_2D;
 	textureInfo.format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM;
 	textureInfo.usage = SDL_GPU_TEXTUREUSAGE_SAMPLER;
-	textureInfo.width = surf.ptr->w;
-	textureInfo.height = surf.ptr->h;
+	textureInfo.width = surface->w;
+	textureInfo.height = surface->h;
 	textureInfo.layer_count_or_depth = 1;
 	textureInfo.num_levels = 1;
 	ScopedTexture texture{m_device, SDL_CreateGPUTexture(m_device, &textureInfo)};
@@ -466,15 +454,15 @@ SDL_GPUTexture* Direct3DRMSDL3GPURenderer::CreateTextureFromSurface(SDL_Surface*
 		SDL_LogError(LOG_CATEGORY_MINIWIN, "SDL_MapGPUTransferBuffer (%s)", SDL_GetError());
 		return nullptr;
 	}
-	memcpy(transferData, surf.ptr->pixels, dataSize);
+	memcpy(transferData, surface->pixels, dataSize);
 	SDL_UnmapGPUTransferBuffer(m_device, transferBuffer);
 
 	SDL_GPUTextureTransferInfo transferRegionInfo = {};
 	transferRegionInfo.transfer_buffer = transferBuffer;
 	SDL_GPUTextureRegion textureRegion = {};
 	textureRegion.texture = texture.ptr;
-	textureRegion.w = surf.ptr->w;
-	textureRegion.h = surf.ptr->h;
+	textureRegion.w = surface->w;
+	textureRegion.h = surface->h;
 	textureRegion.d = 1;
 
 	SDL_GPUCommandBuffer* cmdbuf = SDL_AcquireGPUCommandBuffer(m_device);
@@ -502,15 +490,14 @@ SDL_GPUTexture* Direct3DRMSDL3GPURenderer::CreateTextureFromSurface(SDL_Surface*
 Uint32 Direct3DRMSDL3GPURenderer::GetTextureId(IDirect3DRMTexture* iTexture, bool isUI, float scaleX, float scaleY)
 {
 	auto texture = static_cast<Direct3DRMTextureImpl*>(iTexture);
-	auto surface = static_cast<DirectDrawSurfaceImpl*>(texture->m_surface);
-	SDL_Surface* surf = surface->m_surface;
 
 	for (Uint32 i = 0; i < m_textures.size(); ++i) {
 		auto& tex = m_textures[i];
 		if (tex.texture == texture) {
 			if (tex.version != texture->m_version) {
 				SDL_ReleaseGPUTexture(m_device, tex.gpuTexture);
-				tex.gpuTexture = CreateTextureFromSurface(surf);
+				tex.gpuTexture = CreateTextureFromSurface(texture->GetConvertedSurface(SDL_PIXELFORMAT_RGBA32));
+				texture->ReleaseConvertedSurface();
 				if (!tex.gpuTexture) {
 					return NO_TEXTURE_ID;
 				}
@@ -520,7 +507,8 @@ Uint32 Direct3DRMSDL3GPURenderer::GetTextureId(IDirect3DRMTexture* iTexture, boo
 		}
 	}
 
-	SDL_GPUTexture* newTex = CreateTextureFromSurface(surf);
+	SDL_GPUTexture* newTex = CreateTextureFromSurface(texture->GetConvertedSurface(SDL_PIXELFORMAT_RGBA32));
+	texture->ReleaseConvertedSurface();
 	if (!newTex) {
 		return NO_TEXTURE_ID;
 	}
@@ -541,28 +529,27 @@ Uint32 Direct3DRMSDL3GPURenderer::GetTextureId(IDirect3DRMTexture* iTexture, boo
 
 SDL3MeshCache Direct3DRMSDL3GPURenderer::UploadMesh(const MeshGroup& meshGroup)
 {
-	std::vector<D3DRMVERTEX> finalVertices;
+	bool flat = meshGroup.quality == D3DRMRENDER_FLAT || meshGroup.quality == D3DRMRENDER_UNLITFLAT;
+	std::vector<D3DRMVERTEX> flatVertices;
 	std::vector<Uint16> finalIndices;
 
-	if (meshGroup.quality == D3DRMRENDER_FLAT || meshGroup.quality == D3DRMRENDER_UNLITFLAT) {
-		std::vector<uint16_t> newIndices;
+	if (flat) {
 		FlattenSurfaces(
 			meshGroup.vertices.data(),
 			meshGroup.vertices.size(),
 			meshGroup.indices.data(),
 			meshGroup.indices.size(),
 			true,
-			finalVertices,
-			newIndices
+			flatVertices,
+			finalIndices
 		);
-
-		finalIndices.assign(newIndices.begin(), newIndices.end());
 	}
 	else {
-		finalVertices = meshGroup.vertices;
 		finalIndices.assign(meshGroup.indices.begin(), meshGroup.indices.end());
 	}
 
+	const std::vector<D3DRMVERTEX>& finalVertices = flat ? flatVertices : meshGroup.vertices;
+
 	SDL_GPUBufferCreateInfo vertexBufferCreateInfo = {};
 	vertexBufferCreateInfo.usage = SDL_GPU_BUFFERUSAGE_VERTEX;
 	vertexBufferCreateInfo.size = sizeof(D3DRMVERTEX) * finalVertices.size();
@@ -261,11 +261,16 @@ HRESULT Direct3DRMMeshImpl::SetVertices(D3DRMGROUPINDEX groupIndex, int offset,
 	auto& group = m_groups[groupIndex];
 	auto& vertList = group.vertices;
 
-	if (offset + count > static_cast<int>(vertList.size())) {
-		vertList.resize(offset + count);
+	if (offset == 0 && count >= static_cast<int>(vertList.size())) {
+		vertList.assign(vertices, vertices + count);
 	}
+	else {
+		if (offset + count > static_cast<int>(vertList.size())) {
+			vertList.resize(offset + count);
+		}
 
-	std::copy(vertices, vertices + count, vertList.begin() + offset);
+		std::copy(vertices, vertices + count, vertList.begin() + offset);
+	}
 
 	UpdateBox();
 
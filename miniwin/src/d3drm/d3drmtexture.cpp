@@ -1,4 +1,5 @@
 #include "d3drmtexture_impl.h"
+#include "ddsurface_impl.h"
 #include "miniwin.h"
 
 Direct3DRMTextureImpl::Direct3DRMTextureImpl(D3DRMIMAGE* image)
@@ -19,6 +20,7 @@ Direct3DRMTextureImpl::~Direct3DRMTextureImpl()
 	if (m_holdsRef && m_surface) {
 		m_surface->Release();
 	}
+	SDL_DestroySurface(m_converted);
 }
 
 HRESULT Direct3DRMTextureImpl::QueryInterface(const GUID& riid, void** ppvObject)
@@ -40,3 +42,94 @@ HRESULT Direct3DRMTextureImpl::Changed(BOOL pixels, BOOL palette)
 	m_version++;
 	return DD_OK;
 }
+
+static bool CanExpandIndexed(SDL_Surface* source, SDL_PixelFormat format)
+{
+	return source->format == SDL_PIXELFORMAT_INDEX8 && SDL_GetSurfacePalette(source) &&
+		   !SDL_SurfaceHasColorKey(source) && SDL_BYTESPERPIXEL(format) == 4;
+}
+
+// Expands 8-bit indexed pixels through a lookup table of the palette mapped to the target format
+static void ExpandIndexed(SDL_Surface* source, SDL_Surface* target)
+{
+	const SDL_PixelFormatDetails* details = SDL_GetPixelFormatDetails(target->format);
+	SDL_Palette* palette = SDL_GetSurfacePalette(source);
+
+	Uint32 lut[256];
+	for (int i = 0; i < 256; i++) {
+		if (i < palette->ncolors) {
+			const SDL_Color& color = palette->colors[i];
+			lut[i] = SDL_MapRGBA(details, nullptr, color.r, color.g, color.b, color.a);
+		}
+		else {
+			lut[i] = SDL_MapRGBA(details, nullptr, 0, 0, 0, SDL_ALPHA_OPAQUE);
+		}
+	}
+
+	for (int y = 0; y < source->h; y++) {
+		const Uint8* src = static_cast<const Uint8*>(source->pixels) + y * source->pitch;
+		Uint32* dst = reinterpret_cast<Uint32*>(static_cast<Uint8*>(target->pixels) + y * target->pitch);
+
+		int x = 0;
+		for (; x + 4 <= source->w; x += 4) {
+			dst[x] = lut[src[x]];
+			dst[x + 1] = lut[src[x + 1]];
+			dst[x + 2] = lut[src[x + 2]];
+			dst[x + 3] = lut[src[x + 3]];
+		}
+		for (; x < source->w; x++) {
+			dst[x] = lut[src[x]];
+		}
+	}
+}
+
+SDL_Surface* Direct3DRMTextureImpl::GetConvertedSurface(SDL_PixelFormat format)
+{
+	SDL_Surface* source = static_cast<DirectDrawSurfaceImpl*>(m_surface)->m_surface;
+	if (source->format == format) {
+		return source;
+	}
+
+	if (CanExpandIndexed(source, format)) {
+		// Most textures are converted once. Only those that change after that (animated
+		// or repainted ones) keep their buffer between uploads.
+		m_keepConverted = m_keepConverted || (m_convertedBefore && m_convertedVersion != m_version);
+		m_convertedBefore = true;
+		m_convertedVersion = m_version;
+
+		if (m_converted &&
+			(m_converted->format != format || m_converted->w != source->w || m_converted->h != source->h)) {
+			SDL_DestroySurface(m_converted);
+			m_converted = nullptr;
+		}
+
+		if (!m_converted) {
+			m_converted = SDL_CreateSurface(source->w, source->h, format);
+			if (!m_converted) {
+				SDL_LogError(LOG_CATEGORY_MINIWIN, "SDL_CreateSurface failed: %s", SDL_GetError());
+				return nullptr;
+			}
+		}
+
+		ExpandIndexed(source, m_converted);
+	}
+	else {
+		SDL_DestroySurface(m_converted);
+		m_keepConverted = false;
+		m_converted = SDL_ConvertSurface(source, format);
+		if (!m_converted) {
+			SDL_LogError(LOG_CATEGORY_MINIWIN, "SDL_ConvertSurface failed: %s", SDL_GetError());
+			return nullptr;
+		}
+	}
+
+	return m_converted;
+}
+
+void Direct3DRMTextureImpl::ReleaseConvertedSurface()
+{
+	if (!m_keepConverted) {
+		SDL_DestroySurface(m_converted);
+		m_converted = nullptr;
+	}
+}
@@ -62,7 +62,7 @@ class OpenGLES2Renderer : public Direct3DRMRenderer {
 private:
 	void AddTextureDestroyCallback(Uint32 id, IDirect3DRMTexture* texture);
 	void AddMeshDestroyCallback(Uint32 id, IDirect3DRMMesh* mesh);
-	bool UploadTexture(SDL_Surface* source, GLuint& outTexId, bool isUI);
+	bool UploadTexture(SDL_Surface* surf, GLuint& outTexId, bool isUI);
 
 	MeshGroup m_uiMesh;
 	GLES2MeshCacheEntry m_uiMeshCache;
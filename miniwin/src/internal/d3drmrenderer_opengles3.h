@@ -71,7 +71,7 @@ class OpenGLES3Renderer : public Direct3DRMRenderer {
 	void AddTextureDestroyCallback(Uint32 id, IDirect3DRMTexture* texture);
 	void AddMeshDestroyCallback(Uint32 id, IDirect3DRMMesh* mesh);
 	GLES3MeshCacheEntry GLES3UploadMesh(const MeshGroup& meshGroup, bool forceUV = false);
-	bool UploadTexture(SDL_Surface* source, GLuint& outTexId, bool isUI);
+	bool UploadTexture(SDL_Surface* surf, GLuint& outTexId, bool isUI);
 
 	MeshGroup m_uiMesh;
 	GLES3MeshCacheEntry m_uiMeshCache;
@@ -9,7 +9,18 @@ struct Direct3DRMTextureImpl : public Direct3DRMObjectBaseImpl<IDirect3DRMTextur
 	HRESULT QueryInterface(const GUID& riid, void** ppvObject) override;
 	HRESULT Changed(BOOL pixels, BOOL palette) override;
 
+	// Returns the surface's pixels in the given format for uploading. The result is owned by
+	// the texture; call ReleaseConvertedSurface once the upload is done.
+	SDL_Surface* GetConvertedSurface(SDL_PixelFormat format);
+	void ReleaseConvertedSurface();
+
 	IDirectDrawSurface* m_surface = nullptr;
 	Uint8 m_version = 0;
 	bool m_holdsRef;
+
+private:
+	SDL_Surface* m_converted = nullptr;
+	bool m_convertedBefore = false;
+	Uint8 m_convertedVersion = 0;
+	bool m_keepConverted = false; // Changes after its first upload, reuse the buffer
 };
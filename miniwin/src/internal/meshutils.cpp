@@ -47,21 +47,21 @@ void FlattenSurfaces(
 )
 {
 	std::unordered_map<D3DRMVERTEX, DWORD> uniqueVertexMap;
+	uniqueVertexMap.reserve(indexCount);
 
 	dedupedVertices.reserve(vertexCount);
 	newIndices.reserve(indexCount);
 
 	for (size_t i = 0; i < indexCount; i += 3) {
-		D3DRMVERTEX v0 = vertices[indices[i + 0]];
-		D3DRMVERTEX v1 = vertices[indices[i + 1]];
-		D3DRMVERTEX v2 = vertices[indices[i + 2]];
-		v0.normal = v1.normal = v2.normal = ComputeTriangleNormal(v0.position, v1.position, v2.position);
+		D3DRMVERTEX triangle[3] = {vertices[indices[i + 0]], vertices[indices[i + 1]], vertices[indices[i + 2]]};
+		triangle[0].normal = triangle[1].normal = triangle[2].normal =
+			ComputeTriangleNormal(triangle[0].position, triangle[1].position, triangle[2].position);
 		if (!hasTexture) {
-			v0.texCoord = v1.texCoord = v2.texCoord = {0.0f, 0.0f};
+			triangle[0].texCoord = triangle[1].texCoord = triangle[2].texCoord = {0.0f, 0.0f};
 		}
 
 		// Deduplicate vertecies
-		for (const D3DRMVERTEX& v : {v0, v1, v2}) {
+		for (const D3DRMVERTEX& v : triangle) {
 			auto it = uniqueVertexMap.find(v);
 			if (it != uniqueVertexMap.end()) {
 				newIndices.push_back(it->second);